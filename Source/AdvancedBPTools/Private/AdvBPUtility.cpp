@@ -1,6 +1,136 @@
 // Copyright 2025, Wildlight. All Rights Reserved.
 
 #include "AdvBPUtility.h"
+#include "AdvEasingTable.h"
+
+namespace
+{
+    /**
+     * 2^x for the exponents the Expo curves produce ([-10, 0])
+     * Splits x into a rounded integer written straight into the float exponent bits and a
+     * remainder in [-0.5, 0.5] evaluated with a degree 6 Taylor series (relative error below 3e-7)
+     */
+    FORCEINLINE VectorRegister4Float VectorExp2Easing(const VectorRegister4Float& x)
+    {
+        const VectorRegister4Float IntegerPart = VectorFloor(VectorAdd(x, GlobalVectorConstants::FloatOneHalf));
+        const VectorRegister4Float Fraction = VectorSubtract(x, IntegerPart);
+
+        VectorRegister4Float Poly = VectorSetFloat1(1.54035297e-4f);
+        Poly = VectorMultiplyAdd(Poly, Fraction, VectorSetFloat1(1.33335579e-3f));
+        Poly = VectorMultiplyAdd(Poly, Fraction, VectorSetFloat1(9.61812865e-3f));
+        Poly = VectorMultiplyAdd(Poly, Fraction, VectorSetFloat1(5.55041097e-2f));
+        Poly = VectorMultiplyAdd(Poly, Fraction, VectorSetFloat1(2.40226507e-1f));
+        Poly = VectorMultiplyAdd(Poly, Fraction, VectorSetFloat1(6.93147182e-1f));
+        Poly = VectorMultiplyAdd(Poly, Fraction, GlobalVectorConstants::FloatOne);
+
+        const VectorRegister4Int ExponentBits = VectorShiftLeftImm(VectorIntAdd(VectorFloatToInt(IntegerPart), VectorIntSet1(127)), 23);
+        return VectorMultiply(Poly, VectorCastIntToFloat(ExponentBits));
+    }
+
+    // Vector versions of the easing curves, evaluating four clamped alphas per call
+
+    struct FLinearKernel
+    {
+        static FORCEINLINE VectorRegister4Float Evaluate(const VectorRegister4Float& alpha)
+        {
+            return alpha;
+        }
+    };
+
+    struct FEaseInQuadKernel
+    {
+        static FORCEINLINE VectorRegister4Float Evaluate(const VectorRegister4Float& alpha)
+        {
+            return VectorMultiply(alpha, alpha);
+        }
+    };
+
+    struct FEaseOutQuadKernel
+    {
+        static FORCEINLINE VectorRegister4Float Evaluate(const VectorRegister4Float& alpha)
+        {
+            return VectorMultiply(alpha, VectorSubtract(GlobalVectorConstants::FloatTwo, alpha));
+        }
+    };
+
+    struct FEaseInOutQuadKernel
+    {
+        static FORCEINLINE VectorRegister4Float Evaluate(const VectorRegister4Float& alpha)
+        {
+            // Same arithmetic as the scalar version, both halves evaluated and selected per lane
+            const VectorRegister4Float Doubled = VectorAdd(alpha, alpha);
+            const VectorRegister4Float Lower = VectorMultiply(GlobalVectorConstants::FloatOneHalf, VectorMultiply(Doubled, Doubled));
+
+            const VectorRegister4Float Shifted = VectorSubtract(Doubled, GlobalVectorConstants::FloatOne);
+            const VectorRegister4Float Upper = VectorMultiply(GlobalVectorConstants::FloatOneHalf,
+                VectorSubtract(GlobalVectorConstants::FloatOne, VectorMultiply(Shifted, VectorSubtract(Shifted, GlobalVectorConstants::FloatTwo))));
+
+            return VectorSelect(VectorCompareLT(Doubled, GlobalVectorConstants::FloatOne), Lower, Upper);
+        }
+    };
+
+    struct FExponentialInKernel
+    {
+        static FORCEINLINE VectorRegister4Float Evaluate(const VectorRegister4Float& alpha)
+        {
+            const VectorRegister4Float Result = VectorExp2Easing(VectorMultiply(VectorSetFloat1(10.0f), VectorSubtract(alpha, GlobalVectorConstants::FloatOne)));
+            return VectorSelect(VectorCompareEQ(alpha, GlobalVectorConstants::FloatZero), GlobalVectorConstants::FloatZero, Result);
+        }
+    };
+
+    struct FExponentialOutKernel
+    {
+        static FORCEINLINE VectorRegister4Float Evaluate(const VectorRegister4Float& alpha)
+        {
+            const VectorRegister4Float Result = VectorSubtract(GlobalVectorConstants::FloatOne, VectorExp2Easing(VectorMultiply(VectorSetFloat1(-10.0f), alpha)));
+            return VectorSelect(VectorCompareEQ(alpha, GlobalVectorConstants::FloatOne), GlobalVectorConstants::FloatOne, Result);
+        }
+    };
+
+    struct FExponentialInOutKernel
+    {
+        static FORCEINLINE VectorRegister4Float Evaluate(const VectorRegister4Float& alpha)
+        {
+            // Both halves use 2^(-10 * |2a - 1|), mirrored around 0.5
+            const VectorRegister4Float Doubled = VectorAdd(alpha, alpha);
+            const VectorRegister4Float Shifted = VectorSubtract(Doubled, GlobalVectorConstants::FloatOne);
+            const VectorRegister4Float HalfPower = VectorMultiply(GlobalVectorConstants::FloatOneHalf,
+                VectorExp2Easing(VectorMultiply(VectorSetFloat1(-10.0f), VectorAbs(Shifted))));
+
+            VectorRegister4Float Result = VectorSelect(VectorCompareLT(Doubled, GlobalVectorConstants::FloatOne),
+                HalfPower,
+                VectorSubtract(GlobalVectorConstants::FloatOne, HalfPower));
+
+            Result = VectorSelect(VectorCompareEQ(alpha, GlobalVectorConstants::FloatZero), GlobalVectorConstants::FloatZero, Result);
+            return VectorSelect(VectorCompareEQ(alpha, GlobalVectorConstants::FloatOne), GlobalVectorConstants::FloatOne, Result);
+        }
+    };
+
+    /** Clamps and eases a span four values at a time; the tail is padded so every value goes through the same kernel */
+    template<typename KernelType>
+    void EaseSpan(const float* alphas, float* easedAlphas, int32 count)
+    {
+        const int32 VectorCount = count & ~3;
+
+        for (int32 Index = 0; Index < VectorCount; Index += 4)
+        {
+            const VectorRegister4Float Alpha = VectorMin(VectorMax(VectorLoad(alphas + Index), GlobalVectorConstants::FloatZero), GlobalVectorConstants::FloatOne);
+            VectorStore(KernelType::Evaluate(Alpha), easedAlphas + Index);
+        }
+
+        const int32 Remaining = count - VectorCount;
+        if (Remaining > 0)
+        {
+            float Padded[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            FMemory::Memcpy(Padded, alphas + VectorCount, Remaining * sizeof(float));
+
+            const VectorRegister4Float Alpha = VectorMin(VectorMax(VectorLoad(Padded), GlobalVectorConstants::FloatZero), GlobalVectorConstants::FloatOne);
+            VectorStore(KernelType::Evaluate(Alpha), Padded);
+
+            FMemory::Memcpy(easedAlphas + VectorCount, Padded, Remaining * sizeof(float));
+        }
+    }
+}
 
 float UAdvBPUtilities::ApplyEasing(float alpha, EEasingFunction easingType)
 {
@@ -37,6 +167,85 @@ float UAdvBPUtilities::ApplyEasing(float alpha, EEasingFunction easingType)
     }
 }
 
+float UAdvBPUtilities::ApplyEasingWithPrecision(float alpha, EEasingFunction easingType, EEasingPrecision precision)
+{
+    if (precision == EEasingPrecision::Exact)
+    {
+        return ApplyEasing(alpha, easingType);
+    }
+
+    return FAdvEasingTable::Get(easingType, precision).Evaluate(alpha);
+}
+
+float UAdvBPUtilities::GetEasingTableMaxError(EEasingFunction easingType, EEasingPrecision precision)
+{
+    if (precision == EEasingPrecision::Exact)
+    {
+        return 0.0f;
+    }
+
+    return FAdvEasingTable::Get(easingType, precision).GetMaxError();
+}
+
+float UAdvBPUtilities::ApplyEasingCurve(float alpha, UCurveFloat* curve, EEasingPrecision precision)
+{
+    if (!curve)
+    {
+        return alpha;
+    }
+
+    return FAdvEasingTable::GetForCurve(*curve, precision)->Evaluate(alpha);
+}
+
+void UAdvBPUtilities::ApplyEasingToArray(const TArray<float>& alphas, EEasingFunction easingType, TArray<float>& easedAlphas)
+{
+    easedAlphas.SetNumUninitialized(alphas.Num());
+    ApplyEasingBatch(alphas, easingType, easedAlphas);
+}
+
+void UAdvBPUtilities::ApplyEasingBatch(TConstArrayView<float> alphas, EEasingFunction easingType, TArrayView<float> easedAlphas)
+{
+    check(alphas.Num() == easedAlphas.Num());
+
+    const float* Input = alphas.GetData();
+    float* Output = easedAlphas.GetData();
+    const int32 Count = alphas.Num();
+
+    // Dispatch once for the whole span
+    switch (easingType)
+    {
+    case EEasingFunction::EaseIn:
+        EaseSpan<FEaseInQuadKernel>(Input, Output, Count);
+        break;
+
+    case EEasingFunction::EaseOut:
+        EaseSpan<FEaseOutQuadKernel>(Input, Output, Count);
+        break;
+
+    case EEasingFunction::EaseInOut:
+        EaseSpan<FEaseInOutQuadKernel>(Input, Output, Count);
+        break;
+
+    case EEasingFunction::ExpoIn:
+        EaseSpan<FExponentialInKernel>(Input, Output, Count);
+        break;
+
+    case EEasingFunction::ExpoOut:
+        EaseSpan<FExponentialOutKernel>(Input, Output, Count);
+        break;
+
+    case EEasingFunction::ExpoInOut:
+        EaseSpan<FExponentialInOutKernel>(Input, Output, Count);
+        break;
+
+    case EEasingFunction::Linear:
+    default:
+        // Fallback to linear if unknown type
+        EaseSpan<FLinearKernel>(Input, Output, Count);
+        break;
+    }
+}
+
 float UAdvBPUtilities::EaseFloat(float startValue, float endValue, float alpha, EEasingFunction easingType)
 {
     return EaseValue<float>(startValue, endValue, alpha, easingType);
@@ -47,6 +256,35 @@ FVector UAdvBPUtilities::EaseVector(FVector startValue, FVector endValue, float
     return EaseValue<FVector>(startValue, endValue, alpha, easingType);
 }
 
+FEasingKernel UAdvBPUtilities::ResolveEasingKernel(EEasingFunction easingType)
+{
+    switch (easingType)
+    {
+    case EEasingFunction::EaseIn:
+        return &TEasing<EEasingFunction::EaseIn>::Evaluate;
+
+    case EEasingFunction::EaseOut:
+        return &TEasing<EEasingFunction::EaseOut>::Evaluate;
+
+    case EEasingFunction::EaseInOut:
+        return &TEasing<EEasingFunction::EaseInOut>::Evaluate;
+
+    case EEasingFunction::ExpoIn:
+        return &TEasing<EEasingFunction::ExpoIn>::Evaluate;
+
+    case EEasingFunction::ExpoOut:
+        return &TEasing<EEasingFunction::ExpoOut>::Evaluate;
+
+    case EEasingFunction::ExpoInOut:
+        return &TEasing<EEasingFunction::ExpoInOut>::Evaluate;
+
+    case EEasingFunction::Linear:
+    default:
+        // Fallback to linear if unknown type
+        return &TEasing<EEasingFunction::Linear>::Evaluate;
+    }
+}
+
 FRotator UAdvBPUtilities::EaseRotator(FRotator startValue, FRotator endValue, float alpha, EEasingFunction easingType)
 {
     // Convert rotators to quaternions for optimal interpolation
@@ -0,0 +1,625 @@
+// Copyright 2025, Wildlight. All Rights Reserved.
+
+#include "AdvBenchmark.h"
+#include "AdvBPUtility.h"
+#include "AdvTaskPool.h"
+#include "AdvTweenSubsystem.h"
+#include "AsyncTools.h"
+#include "LatentTools.h"
+#include "Components/SceneComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/Paths.h"
+#include "UObject/GCObject.h"
+#include "UObject/UObjectArray.h"
+#include "UObject/UObjectGlobals.h"
+
+namespace
+{
+    // Simulated frame step
+    constexpr float BenchmarkDeltaTime = 1.0f / 60.0f;
+
+#if !UE_BUILD_SHIPPING
+    void RunLatentVsAsyncCommand(const TArray<FString>& args, UWorld* world, FOutputDevice& ar)
+    {
+        const int32 NumTweens = args.Num() > 0 ? FCString::Atoi(*args[0]) : 1000;
+        const int32 NumFrames = args.Num() > 1 ? FCString::Atoi(*args[1]) : 60;
+
+        FAdvBenchmark::LogResult(FAdvBenchmark::RunLatentVsAsync(world, NumTweens, NumFrames), ar);
+    }
+
+    FAutoConsoleCommandWithWorldArgsAndOutputDevice LatentVsAsyncCommand(
+        TEXT("AdvBPTools.Bench.LatentVsAsync"),
+        TEXT("Compares the per-tween cost of the latent move action and the async move node. Usage: AdvBPTools.Bench.LatentVsAsync [NumTweens=1000] [NumFrames=60]"),
+        FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&RunLatentVsAsyncCommand));
+
+    void RunScaleCommand(const TArray<FString>& args, UWorld* world, FOutputDevice& ar)
+    {
+        const int32 NumTweens = args.Num() > 0 ? FCString::Atoi(*args[0]) : 10000;
+        const int32 NumFrames = args.Num() > 1 ? FCString::Atoi(*args[1]) : 120;
+
+        for (const FString& Row : FAdvBenchmark::ToCsvRows(FAdvBenchmark::RunScaleSuite(world, { NumTweens }, NumFrames)))
+        {
+            ar.Log(Row);
+        }
+    }
+
+    FAutoConsoleCommandWithWorldArgsAndOutputDevice ScaleCommand(
+        TEXT("AdvBPTools.Bench.Scale"),
+        TEXT("Runs concurrent async move, rotate and scale tweens and prints CSV rows. Usage: AdvBPTools.Bench.Scale [NumTweens=10000] [NumFrames=120]"),
+        FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&RunScaleCommand));
+#endif
+
+    // Alphas cycled through by the easing benchmark, a power of two so indexing is a mask
+    constexpr int32 NumEasingBenchmarkAlphas = 4096;
+
+    constexpr int32 NumEasingFunctions = static_cast<int32>(EEasingFunction::ExpoInOut) + 1;
+
+    // Results are summed into this so the evaluations cannot be optimized away
+    volatile double GEasingBenchmarkSink = 0.0;
+
+#if !UE_BUILD_SHIPPING
+    void RunEasingCommand(const TArray<FString>& args, UWorld* world, FOutputDevice& ar)
+    {
+        const int32 NumEvaluations = args.Num() > 0 ? FCString::Atoi(*args[0]) : 1000000;
+        FAdvBenchmark::LogResult(FAdvBenchmark::RunEasing(NumEvaluations), ar);
+    }
+
+    FAutoConsoleCommandWithWorldArgsAndOutputDevice EasingCommand(
+        TEXT("AdvBPTools.Bench.Easing"),
+        TEXT("Times every easing curve through the scalar, kernel, batch and Ease* paths. Usage: AdvBPTools.Bench.Easing [NumEvaluations=1000000]"),
+        FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&RunEasingCommand));
+
+    void RunEasingAccuracyCommand(const TArray<FString>& args, UWorld* world, FOutputDevice& ar)
+    {
+        const int32 NumSamples = args.Num() > 0 ? FCString::Atoi(*args[0]) : 100001;
+        FAdvBenchmark::LogResult(FAdvBenchmark::CheckEasingAccuracy(NumSamples), ar);
+    }
+
+    FAutoConsoleCommandWithWorldArgsAndOutputDevice EasingAccuracyCommand(
+        TEXT("AdvBPTools.Bench.EasingAccuracy"),
+        TEXT("Checks every easing path against double precision reference curves. Usage: AdvBPTools.Bench.EasingAccuracy [NumSamples=100001]"),
+        FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateStatic(&RunEasingAccuracyCommand));
+#endif
+
+    const TCHAR* GetEasingName(EEasingFunction easingType)
+    {
+        switch (easingType)
+        {
+        case EEasingFunction::EaseIn:
+            return TEXT("EaseIn");
+
+        case EEasingFunction::EaseOut:
+            return TEXT("EaseOut");
+
+        case EEasingFunction::EaseInOut:
+            return TEXT("EaseInOut");
+
+        case EEasingFunction::ExpoIn:
+            return TEXT("ExpoIn");
+
+        case EEasingFunction::ExpoOut:
+            return TEXT("ExpoOut");
+
+        case EEasingFunction::ExpoInOut:
+            return TEXT("ExpoInOut");
+
+        default:
+            return TEXT("Linear");
+        }
+    }
+
+    /** The easing curves in double precision, special cases included, as the reference for every float path */
+    double EvaluateReferenceEasing(double alpha, EEasingFunction easingType)
+    {
+        switch (easingType)
+        {
+        case EEasingFunction::EaseIn:
+            return alpha * alpha;
+
+        case EEasingFunction::EaseOut:
+            return alpha * (2.0 - alpha);
+
+        case EEasingFunction::EaseInOut:
+            return alpha < 0.5 ? 2.0 * alpha * alpha : 1.0 - 2.0 * (1.0 - alpha) * (1.0 - alpha);
+
+        case EEasingFunction::ExpoIn:
+            return alpha == 0.0 ? 0.0 : FMath::Pow(2.0, 10.0 * (alpha - 1.0));
+
+        case EEasingFunction::ExpoOut:
+            return alpha == 1.0 ? 1.0 : 1.0 - FMath::Pow(2.0, -10.0 * alpha);
+
+        case EEasingFunction::ExpoInOut:
+            if (alpha == 0.0 || alpha == 1.0)
+            {
+                return alpha;
+            }
+            return alpha < 0.5
+                ? 0.5 * FMath::Pow(2.0, 20.0 * alpha - 10.0)
+                : 1.0 - 0.5 * FMath::Pow(2.0, -20.0 * alpha + 10.0);
+
+        default:
+            return alpha;
+        }
+    }
+
+    /** Times a loop over the benchmark alphas, in nanoseconds per evaluation */
+    template<typename FunctionType>
+    double TimeEasingPath(const TArray<float>& alphas, int32 numEvaluations, FunctionType&& function)
+    {
+        double Sum = 0.0;
+        const double StartTime = FPlatformTime::Seconds();
+        for (int32 Evaluation = 0; Evaluation < numEvaluations; ++Evaluation)
+        {
+            Sum += function(alphas[Evaluation & (NumEasingBenchmarkAlphas - 1)]);
+        }
+        const double Elapsed = FPlatformTime::Seconds() - StartTime;
+
+        GEasingBenchmarkSink = GEasingBenchmarkSink + Sum;
+        return Elapsed * 1.0e9 / numEvaluations;
+    }
+
+    /** Keeps the tasks a benchmark started alive for the whole run, as the Blueprint graph owning the nodes would */
+    class FBenchmarkTaskCollector : public FGCObject
+    {
+    public:
+        TArray<TObjectPtr<UAdvAsyncTweenTask>> Tasks;
+
+        // FGCObject interface
+        virtual void AddReferencedObjects(FReferenceCollector& collector) override
+        {
+            collector.AddReferencedObjects(Tasks);
+        }
+
+        virtual FString GetReferencerName() const override
+        {
+            return TEXT("FAdvBenchmark");
+        }
+    };
+
+    const TCHAR* GetChannelName(ETweenChannel channel)
+    {
+        switch (channel)
+        {
+        case ETweenChannel::Rotation:
+            return TEXT("Rotate");
+
+        case ETweenChannel::Scale:
+            return TEXT("Scale");
+
+        default:
+            return TEXT("Move");
+        }
+    }
+}
+
+FAdvLatentVsAsyncResult FAdvBenchmark::RunLatentVsAsync(UWorld* world, int32 numTweens, int32 numFrames)
+{
+    FAdvLatentVsAsyncResult Result;
+    Result.NumTweens = FMath::Max(1, numTweens);
+    Result.NumFrames = FMath::Max(1, numFrames);
+
+    UAdvTweenSubsystem* TweenSubsystem = UAdvTweenSubsystem::Get(world);
+    UAdvTaskPoolSubsystem* TaskPool = UAdvTaskPoolSubsystem::Get(world);
+    if (!TweenSubsystem || !TaskPool)
+    {
+        return Result;
+    }
+
+    // Long enough that no tween completes, so only start and update costs are measured
+    const float Duration = BenchmarkDeltaTime * Result.NumFrames * 10.0f;
+    const FVector Offset(1000.0f, 0.0f, 0.0f);
+
+    TArray<AActor*> Actors;
+    SpawnBenchmarkActors(world, Result.NumTweens, Actors);
+
+    // Latent path, each action resumes nothing and is removed again afterwards
+    FLatentActionManager& LatentActionManager = world->GetLatentActionManager();
+    TArray<ELatentActionResult> LatentResults;
+    LatentResults.SetNumZeroed(Actors.Num());
+
+    double StartTime = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < Actors.Num(); ++Index)
+    {
+        FLatentActionInfo LatentInfo;
+        LatentInfo.CallbackTarget = Actors[Index];
+        LatentInfo.UUID = Index;
+        LatentInfo.Linkage = INDEX_NONE;
+        LatentInfo.ExecutionFunction = NAME_None;
+
+        LatentActionManager.AddNewAction(Actors[Index], Index, new FMoveActorToLocationAction(
+            Actors[Index], Actors[Index]->GetActorLocation() + Offset, Duration, false, EEasingFunction::EaseInOut, LatentInfo, LatentResults[Index]));
+    }
+    Result.LatentStartMicros = (FPlatformTime::Seconds() - StartTime) * 1.0e6 / Actors.Num();
+
+    StartTime = FPlatformTime::Seconds();
+    for (int32 Frame = 0; Frame < Result.NumFrames; ++Frame)
+    {
+        LatentActionManager.BeginFrame();
+        LatentActionManager.ProcessLatentActions(nullptr, BenchmarkDeltaTime);
+    }
+    Result.LatentUpdateMicros = (FPlatformTime::Seconds() - StartTime) * 1.0e6 / (Actors.Num() * Result.NumFrames);
+
+    for (AActor* Actor : Actors)
+    {
+        LatentActionManager.RemoveActionsForObject(Actor);
+    }
+
+    // Async path through the same node Blueprints use
+    const int32 MissesBefore = TaskPool->GetStats().Misses;
+
+    StartTime = FPlatformTime::Seconds();
+    for (AActor* Actor : Actors)
+    {
+        UAsyncMoveActorTask* Task = UAsyncMoveActorTask::MoveActor(
+            world, Actor, Actor->GetActorLocation() + Offset, Duration, EMoveTimingMode::Duration, EEasingFunction::EaseInOut);
+        Task->Activate();
+    }
+    Result.AsyncStartMicros = (FPlatformTime::Seconds() - StartTime) * 1.0e6 / Actors.Num();
+    Result.AsyncTaskAllocations = TaskPool->GetStats().Misses - MissesBefore;
+
+    StartTime = FPlatformTime::Seconds();
+    for (int32 Frame = 0; Frame < Result.NumFrames; ++Frame)
+    {
+        TweenSubsystem->Tick(BenchmarkDeltaTime);
+    }
+    Result.AsyncUpdateMicros = (FPlatformTime::Seconds() - StartTime) * 1.0e6 / (Actors.Num() * Result.NumFrames);
+
+    // Tweens on destroyed actors fail on the next update, which completes their tasks
+    DestroyBenchmarkActors(Actors);
+    TweenSubsystem->Tick(0.0f);
+
+    return Result;
+}
+
+void FAdvBenchmark::LogResult(const FAdvLatentVsAsyncResult& result, FOutputDevice& ar)
+{
+    ar.Logf(TEXT("Latent vs async move, %d tweens over %d frames (microseconds per tween)"), result.NumTweens, result.NumFrames);
+    ar.Logf(TEXT("  %-8s %12s %16s"), TEXT("Path"), TEXT("Start"), TEXT("Update/frame"));
+    ar.Logf(TEXT("  %-8s %12.3f %16.3f"), TEXT("Latent"), result.LatentStartMicros, result.LatentUpdateMicros);
+    ar.Logf(TEXT("  %-8s %12.3f %16.3f"), TEXT("Async"), result.AsyncStartMicros, result.AsyncUpdateMicros);
+    ar.Logf(TEXT("  Async task objects allocated: %d"), result.AsyncTaskAllocations);
+}
+
+FAdvScaleBenchmarkResult FAdvBenchmark::RunScale(UWorld* world, ETweenChannel channel, int32 numTweens, int32 numFrames)
+{
+    FAdvScaleBenchmarkResult Result;
+    Result.Channel = channel;
+    Result.NumTweens = FMath::Max(1, numTweens);
+    Result.NumFrames = FMath::Max(1, numFrames);
+
+    UAdvTweenSubsystem* TweenSubsystem = UAdvTweenSubsystem::Get(world);
+    UAdvTaskPoolSubsystem* TaskPool = UAdvTaskPoolSubsystem::Get(world);
+    if (!TweenSubsystem || !TaskPool)
+    {
+        return Result;
+    }
+
+    // Long enough that no tween completes, so only start and update costs are measured
+    const float Duration = BenchmarkDeltaTime * Result.NumFrames * 10.0f;
+
+    TArray<AActor*> Actors;
+    SpawnBenchmarkActors(world, Result.NumTweens, Actors);
+
+    // Start through the same nodes Blueprints use, keeping every task referenced until its tween completes
+    FBenchmarkTaskCollector TaskCollector;
+    TaskCollector.Tasks.Reserve(Actors.Num());
+
+    const int32 MissesBefore = TaskPool->GetStats().Misses;
+    const int32 ObjectsBefore = GUObjectArray.GetObjectArrayNumMinusAvailable();
+    const uint64 MemoryBefore = FPlatformMemory::GetStats().UsedPhysical;
+
+    double StartTime = FPlatformTime::Seconds();
+    for (AActor* Actor : Actors)
+    {
+        UAdvAsyncTweenTask* Task = nullptr;
+        switch (channel)
+        {
+        case ETweenChannel::Rotation:
+            Task = UAsyncRotateActorTask::RotateActor(
+                world, Actor, FRotator(0.0f, 170.0f, 0.0f), Duration, EMoveTimingMode::Duration, EEasingFunction::EaseInOut);
+            break;
+
+        case ETweenChannel::Scale:
+            Task = UAsyncScaleActorTask::ScaleActor(world, Actor, FVector(2.0f), Duration, EEasingFunction::EaseInOut);
+            break;
+
+        default:
+            Task = UAsyncMoveActorTask::MoveActor(
+                world, Actor, Actor->GetActorLocation() + FVector(1000.0f, 0.0f, 0.0f), Duration, EMoveTimingMode::Duration, EEasingFunction::EaseInOut);
+            break;
+        }
+        TaskCollector.Tasks.Add(Task);
+        Task->Activate();
+    }
+    Result.StartMicros = (FPlatformTime::Seconds() - StartTime) * 1.0e6 / Actors.Num();
+    Result.TaskAllocations = TaskPool->GetStats().Misses - MissesBefore;
+    Result.ObjectsCreated = GUObjectArray.GetObjectArrayNumMinusAvailable() - ObjectsBefore;
+
+    double TotalFrameSeconds = 0.0;
+    for (int32 Frame = 0; Frame < Result.NumFrames; ++Frame)
+    {
+        StartTime = FPlatformTime::Seconds();
+        TweenSubsystem->Tick(BenchmarkDeltaTime);
+        const double FrameSeconds = FPlatformTime::Seconds() - StartTime;
+
+        TotalFrameSeconds += FrameSeconds;
+        Result.MaxFrameMs = FMath::Max(Result.MaxFrameMs, FrameSeconds * 1.0e3);
+    }
+    Result.AvgFrameMs = TotalFrameSeconds * 1.0e3 / Result.NumFrames;
+    Result.UpdateMicrosPerTween = TotalFrameSeconds * 1.0e6 / (Actors.Num() * Result.NumFrames);
+    Result.MemoryDeltaKB = (static_cast<int64>(FPlatformMemory::GetStats().UsedPhysical) - static_cast<int64>(MemoryBefore)) / 1024;
+
+    // Everything the tweens keep alive is walked by a full purge; every task is still referenced, so nothing is destroyed
+    StartTime = FPlatformTime::Seconds();
+    CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+    Result.GcMs = (FPlatformTime::Seconds() - StartTime) * 1.0e3;
+
+    // Tweens on destroyed actors fail on the next update, which completes their tasks
+    DestroyBenchmarkActors(Actors);
+    TweenSubsystem->Tick(0.0f);
+
+    return Result;
+}
+
+TArray<FAdvEasingBenchmarkResult> FAdvBenchmark::RunEasing(int32 numEvaluations)
+{
+    const int32 NumEvaluations = FMath::Max(NumEasingBenchmarkAlphas, numEvaluations);
+
+    // Spread the alphas over the whole range, including both endpoints
+    TArray<float> Alphas;
+    Alphas.SetNumUninitialized(NumEasingBenchmarkAlphas);
+    for (int32 Index = 0; Index < NumEasingBenchmarkAlphas; ++Index)
+    {
+        Alphas[Index] = static_cast<float>(Index) / (NumEasingBenchmarkAlphas - 1);
+    }
+
+    TArray<float> BatchOutput;
+    BatchOutput.SetNumUninitialized(NumEasingBenchmarkAlphas);
+
+    const FVector StartVector(0.0f, 0.0f, 0.0f);
+    const FVector EndVector(100.0f, 200.0f, 300.0f);
+    const FRotator StartRotator(0.0f, 0.0f, 0.0f);
+    const FRotator EndRotator(30.0f, 170.0f, 45.0f);
+
+    TArray<FAdvEasingBenchmarkResult> Results;
+    for (int32 EasingIndex = 0; EasingIndex < NumEasingFunctions; ++EasingIndex)
+    {
+        const EEasingFunction EasingType = static_cast<EEasingFunction>(EasingIndex);
+        const FEasingKernel Kernel = UAdvBPUtilities::ResolveEasingKernel(EasingType);
+
+        FAdvEasingBenchmarkResult& Result = Results.AddDefaulted_GetRef();
+        Result.EasingType = EasingType;
+
+        Result.ApplyEasingNs = TimeEasingPath(Alphas, NumEvaluations,
+            [EasingType](float alpha) { return UAdvBPUtilities::ApplyEasing(alpha, EasingType); });
+
+        Result.KernelNs = TimeEasingPath(Alphas, NumEvaluations,
+            [Kernel](float alpha) { return Kernel(alpha); });
+
+        Result.EaseFloatNs = TimeEasingPath(Alphas, NumEvaluations,
+            [EasingType](float alpha) { return UAdvBPUtilities::EaseFloat(0.0f, 100.0f, alpha, EasingType); });
+
+        Result.EaseVectorNs = TimeEasingPath(Alphas, NumEvaluations,
+            [EasingType, &StartVector, &EndVector](float alpha) { return UAdvBPUtilities::EaseVector(StartVector, EndVector, alpha, EasingType).X; });
+
+        Result.EaseRotatorNs = TimeEasingPath(Alphas, NumEvaluations,
+            [EasingType, &StartRotator, &EndRotator](float alpha) { return UAdvBPUtilities::EaseRotator(StartRotator, EndRotator, alpha, EasingType).Yaw; });
+
+        // Batches go through the whole alpha set at once
+        const int32 NumBatches = NumEvaluations / NumEasingBenchmarkAlphas;
+        double Sum = 0.0;
+        const double StartTime = FPlatformTime::Seconds();
+        for (int32 Batch = 0; Batch < NumBatches; ++Batch)
+        {
+            UAdvBPUtilities::ApplyEasingBatch(Alphas, EasingType, BatchOutput);
+            Sum += BatchOutput[Batch & (NumEasingBenchmarkAlphas - 1)];
+        }
+        Result.BatchNs = (FPlatformTime::Seconds() - StartTime) * 1.0e9 / (NumBatches * NumEasingBenchmarkAlphas);
+        GEasingBenchmarkSink = GEasingBenchmarkSink + Sum;
+    }
+
+    return Results;
+}
+
+void FAdvBenchmark::LogResult(TConstArrayView<FAdvEasingBenchmarkResult> results, FOutputDevice& ar)
+{
+    ar.Logf(TEXT("Easing paths (nanoseconds per evaluation, millions of evaluations per second for ApplyEasing and batch)"));
+    ar.Logf(TEXT("  %-10s %10s %10s %10s %10s %10s %10s %10s %10s"),
+        TEXT("Curve"), TEXT("Apply"), TEXT("Kernel"), TEXT("Batch"), TEXT("Float"), TEXT("Vector"), TEXT("Rotator"), TEXT("Apply M/s"), TEXT("Batch M/s"));
+
+    for (const FAdvEasingBenchmarkResult& Result : results)
+    {
+        ar.Logf(TEXT("  %-10s %10.2f %10.2f %10.2f %10.2f %10.2f %10.2f %10.1f %10.1f"),
+            GetEasingName(Result.EasingType),
+            Result.ApplyEasingNs, Result.KernelNs, Result.BatchNs, Result.EaseFloatNs, Result.EaseVectorNs, Result.EaseRotatorNs,
+            Result.ApplyEasingNs > 0.0 ? 1.0e3 / Result.ApplyEasingNs : 0.0,
+            Result.BatchNs > 0.0 ? 1.0e3 / Result.BatchNs : 0.0);
+    }
+}
+
+TArray<FAdvEasingAccuracyResult> FAdvBenchmark::CheckEasingAccuracy(int32 numSamples)
+{
+    const int32 NumSamples = FMath::Max(2, numSamples);
+
+    TArray<float> Alphas;
+    Alphas.SetNumUninitialized(NumSamples);
+    for (int32 Index = 0; Index < NumSamples; ++Index)
+    {
+        Alphas[Index] = static_cast<float>(Index) / (NumSamples - 1);
+    }
+
+    TArray<float> BatchOutput;
+    BatchOutput.SetNumUninitialized(NumSamples);
+
+    TArray<FAdvEasingAccuracyResult> Results;
+    for (int32 EasingIndex = 0; EasingIndex < NumEasingFunctions; ++EasingIndex)
+    {
+        const EEasingFunction EasingType = static_cast<EEasingFunction>(EasingIndex);
+        const FEasingKernel Kernel = UAdvBPUtilities::ResolveEasingKernel(EasingType);
+        UAdvBPUtilities::ApplyEasingBatch(Alphas, EasingType, BatchOutput);
+
+        FAdvEasingAccuracyResult& Result = Results.AddDefaulted_GetRef();
+        Result.EasingType = EasingType;
+
+        for (int32 Index = 0; Index < NumSamples; ++Index)
+        {
+            // The reference sees the same float alpha the paths see
+            const double Reference = EvaluateReferenceEasing(Alphas[Index], EasingType);
+            Result.ApplyEasingMaxError = FMath::Max(Result.ApplyEasingMaxError, FMath::Abs(UAdvBPUtilities::ApplyEasing(Alphas[Index], EasingType) - Reference));
+            Result.KernelMaxError = FMath::Max(Result.KernelMaxError, FMath::Abs(Kernel(Alphas[Index]) - Reference));
+            Result.BatchMaxError = FMath::Max(Result.BatchMaxError, FMath::Abs(BatchOutput[Index] - Reference));
+        }
+
+        const int32 LastIndex = NumSamples - 1;
+        Result.bApplyEasingEndpointsExact = UAdvBPUtilities::ApplyEasing(0.0f, EasingType) == 0.0f && UAdvBPUtilities::ApplyEasing(1.0f, EasingType) == 1.0f;
+        Result.bKernelEndpointsExact = Kernel(0.0f) == 0.0f && Kernel(1.0f) == 1.0f;
+        Result.bBatchEndpointsExact = BatchOutput[0] == 0.0f && BatchOutput[LastIndex] == 1.0f;
+
+        Result.bPassed = Result.bApplyEasingEndpointsExact && Result.bKernelEndpointsExact && Result.bBatchEndpointsExact
+            && Result.KernelMaxError <= Result.ApplyEasingMaxError + EasingAccuracyTolerance
+            && Result.BatchMaxError <= Result.ApplyEasingMaxError + EasingAccuracyTolerance;
+    }
+
+    return Results;
+}
+
+bool FAdvBenchmark::LogResult(TConstArrayView<FAdvEasingAccuracyResult> results, FOutputDevice& ar)
+{
+    ar.Logf(TEXT("Easing accuracy against double precision reference (max absolute error, endpoints exact)"));
+    ar.Logf(TEXT("  %-10s %12s %12s %12s %10s %6s"), TEXT("Curve"), TEXT("Apply"), TEXT("Kernel"), TEXT("Batch"), TEXT("Endpoints"), TEXT("Result"));
+
+    bool bAllPassed = true;
+    for (const FAdvEasingAccuracyResult& Result : results)
+    {
+        const bool bEndpointsExact = Result.bApplyEasingEndpointsExact && Result.bKernelEndpointsExact && Result.bBatchEndpointsExact;
+        ar.Logf(TEXT("  %-10s %12.3e %12.3e %12.3e %10s %6s"),
+            GetEasingName(Result.EasingType),
+            Result.ApplyEasingMaxError, Result.KernelMaxError, Result.BatchMaxError,
+            bEndpointsExact ? TEXT("yes") : TEXT("NO"),
+            Result.bPassed ? TEXT("ok") : TEXT("FAIL"));
+
+        bAllPassed &= Result.bPassed;
+    }
+
+    return bAllPassed;
+}
+
+TArray<FAdvScaleBenchmarkResult> FAdvBenchmark::RunScaleSuite(UWorld* world, TConstArrayView<int32> tweenCounts, int32 numFrames)
+{
+    TArray<FAdvScaleBenchmarkResult> Results;
+    for (const int32 NumTweens : tweenCounts)
+    {
+        if (NumTweens <= 0)
+        {
+            continue;
+        }
+
+        for (const ETweenChannel Channel : { ETweenChannel::Location, ETweenChannel::Rotation, ETweenChannel::Scale })
+        {
+            Results.Add(RunScale(world, Channel, NumTweens, numFrames));
+
+            // Start every run from the same heap and object state
+            CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS, true);
+        }
+    }
+
+    return Results;
+}
+
+UWorld* FAdvBenchmark::CreateBenchmarkWorld()
+{
+    if (!GEngine)
+    {
+        return nullptr;
+    }
+
+    // A bare game world is enough, the world subsystems come up with it
+    UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("AdvBenchmark"));
+    FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+    WorldContext.SetCurrentWorld(World);
+    World->InitializeActorsForPlay(FURL());
+    World->BeginPlay();
+
+    return World;
+}
+
+void FAdvBenchmark::DestroyBenchmarkWorld(UWorld* world)
+{
+    if (!world)
+    {
+        return;
+    }
+
+    GEngine->DestroyWorldContext(world);
+    world->DestroyWorld(false);
+}
+
+FString FAdvBenchmark::GetDefaultScaleCsvPath()
+{
+    return FPaths::ProjectSavedDir() / TEXT("AdvBPTools") / TEXT("ScaleBenchmark.csv");
+}
+
+FString FAdvBenchmark::GetScaleCsvHeader()
+{
+    return TEXT("Kind,NumTweens,NumFrames,StartMicros,AvgFrameMs,MaxFrameMs,UpdateMicrosPerTween,TaskAllocations,ObjectsCreated,MemoryDeltaKB,GcMs");
+}
+
+FString FAdvBenchmark::ToCsvRow(const FAdvScaleBenchmarkResult& result)
+{
+    return FString::Printf(TEXT("%s,%d,%d,%.3f,%.3f,%.3f,%.4f,%d,%d,%lld,%.3f"),
+        GetChannelName(result.Channel), result.NumTweens, result.NumFrames, result.StartMicros, result.AvgFrameMs, result.MaxFrameMs,
+        result.UpdateMicrosPerTween, result.TaskAllocations, result.ObjectsCreated, result.MemoryDeltaKB, result.GcMs);
+}
+
+TArray<FString> FAdvBenchmark::ToCsvRows(TConstArrayView<FAdvScaleBenchmarkResult> results)
+{
+    TArray<FString> Rows;
+    Rows.Reserve(results.Num() + 1);
+    Rows.Add(GetScaleCsvHeader());
+    for (const FAdvScaleBenchmarkResult& Result : results)
+    {
+        Rows.Add(ToCsvRow(Result));
+    }
+
+    return Rows;
+}
+
+void FAdvBenchmark::SpawnBenchmarkActors(UWorld* world, int32 numActors, TArray<AActor*>& outActors)
+{
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.ObjectFlags |= RF_Transient;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+    outActors.Reset(numActors);
+    for (int32 Index = 0; Index < numActors; ++Index)
+    {
+        AActor* Actor = world->SpawnActor<AActor>(AActor::StaticClass(), FTransform(FVector(0.0f, Index * 100.0f, 0.0f)), SpawnParams);
+        if (!Actor)
+        {
+            continue;
+        }
+
+        USceneComponent* Root = NewObject<USceneComponent>(Actor, TEXT("BenchmarkRoot"));
+        Actor->SetRootComponent(Root);
+        Root->RegisterComponent();
+        Root->SetWorldLocation(FVector(0.0f, Index * 100.0f, 0.0f));
+
+        outActors.Add(Actor);
+    }
+}
+
+void FAdvBenchmark::DestroyBenchmarkActors(TArray<AActor*>& actors)
+{
+    for (AActor* Actor : actors)
+    {
+        if (IsValid(Actor))
+        {
+            Actor->Destroy();
+        }
+    }
+    actors.Reset();
+}
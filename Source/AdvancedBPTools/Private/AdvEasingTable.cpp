@@ -0,0 +1,163 @@
+// Copyright 2025, Wildlight. All Rights Reserved.
+
+#include "AdvEasingTable.h"
+#include "AdvBPUtility.h"
+#include "Curves/CurveFloat.h"
+#include "UObject/ObjectKey.h"
+
+namespace
+{
+    // Reference points checked between each pair of entries when measuring the error
+    constexpr int32 ErrorSamplesPerInterval = 16;
+
+    constexpr int32 NumEasingFunctions = static_cast<int32>(EEasingFunction::ExpoInOut) + 1;
+    constexpr int32 NumTablePrecisions = static_cast<int32>(EEasingPrecision::Table1024);
+
+    /** Every curve at every table size, built together the first time any table is requested */
+    struct FAdvEasingTableSet
+    {
+        TArray<FAdvEasingTable> Tables;
+
+        FAdvEasingTableSet()
+        {
+            Tables.Reserve(NumEasingFunctions * NumTablePrecisions);
+
+            for (int32 EasingIndex = 0; EasingIndex < NumEasingFunctions; ++EasingIndex)
+            {
+                const EEasingFunction EasingType = static_cast<EEasingFunction>(EasingIndex);
+
+                for (int32 PrecisionIndex = 1; PrecisionIndex <= NumTablePrecisions; ++PrecisionIndex)
+                {
+                    Tables.Emplace(
+                        [EasingType](float alpha) { return UAdvBPUtilities::ApplyEasing(alpha, EasingType); },
+                        FAdvEasingTable::GetNumEntries(static_cast<EEasingPrecision>(PrecisionIndex)));
+                }
+            }
+        }
+    };
+
+    /** Baked table of one curve asset at one size */
+    struct FAdvCurveTableEntry
+    {
+        TSharedPtr<const FAdvEasingTable> Table;
+
+#if WITH_EDITOR
+        // Keys the table was baked from, designers edit curves while tweens play
+        uint32 KeysHash = 0;
+#endif
+    };
+
+    using FAdvCurveTableKey = TPair<TObjectKey<UCurveFloat>, uint8>;
+
+#if WITH_EDITOR
+    uint32 HashCurveKeys(const FRichCurve& curve)
+    {
+        const TArray<FRichCurveKey>& Keys = curve.GetConstRefOfKeys();
+        return FCrc::MemCrc32(Keys.GetData(), Keys.Num() * sizeof(FRichCurveKey));
+    }
+#endif
+}
+
+FAdvEasingTable::FAdvEasingTable(TFunctionRef<float(float)> curve, int32 numEntries)
+    : LastIndex(FMath::Max(2, numEntries) - 1)
+    , MaxError(0.0f)
+{
+    // Sample the curve at evenly spaced alphas, both endpoints included
+    Samples.SetNumUninitialized(LastIndex + 1);
+    for (int32 Index = 0; Index <= LastIndex; ++Index)
+    {
+        Samples[Index] = curve(static_cast<float>(Index) / LastIndex);
+    }
+
+    // Measure the worst interpolation error on a denser grid
+    const int32 NumChecks = LastIndex * ErrorSamplesPerInterval;
+    for (int32 Check = 0; Check <= NumChecks; ++Check)
+    {
+        const float Alpha = static_cast<float>(Check) / NumChecks;
+        MaxError = FMath::Max(MaxError, FMath::Abs(Evaluate(Alpha) - curve(Alpha)));
+    }
+}
+
+const FAdvEasingTable& FAdvEasingTable::Get(EEasingFunction easingType, EEasingPrecision precision)
+{
+    check(precision != EEasingPrecision::Exact);
+
+    static const FAdvEasingTableSet TableSet;
+
+    const int32 EasingIndex = FMath::Clamp(static_cast<int32>(easingType), 0, NumEasingFunctions - 1);
+    const int32 PrecisionIndex = FMath::Clamp(static_cast<int32>(precision), 1, NumTablePrecisions) - 1;
+
+    return TableSet.Tables[EasingIndex * NumTablePrecisions + PrecisionIndex];
+}
+
+TSharedRef<const FAdvEasingTable> FAdvEasingTable::GetForCurve(const UCurveFloat& curve, EEasingPrecision precision)
+{
+    check(IsInGameThread());
+
+    static TMap<FAdvCurveTableKey, FAdvCurveTableEntry> CurveTables;
+
+    const EEasingPrecision TablePrecision = precision == EEasingPrecision::Exact ? EEasingPrecision::Table1024 : precision;
+    const FAdvCurveTableKey Key(&curve, static_cast<uint8>(TablePrecision));
+
+#if WITH_EDITOR
+    const uint32 KeysHash = HashCurveKeys(curve.FloatCurve);
+#endif
+
+    if (const FAdvCurveTableEntry* Entry = CurveTables.Find(Key))
+    {
+#if WITH_EDITOR
+        if (Entry->KeysHash == KeysHash)
+#endif
+        {
+            return Entry->Table.ToSharedRef();
+        }
+    }
+    else
+    {
+        // Tables of unloaded curves are only kept alive by the tweens still using them
+        for (auto It = CurveTables.CreateIterator(); It; ++It)
+        {
+            if (!It->Key.Key.ResolveObjectPtr())
+            {
+                It.RemoveCurrent();
+            }
+        }
+    }
+
+    // Bake over the curve's own time range, an empty curve falls back to 0.0-1.0
+    float MinTime = 0.0f;
+    float MaxTime = 0.0f;
+    curve.FloatCurve.GetTimeRange(MinTime, MaxTime);
+    const float TimeSpan = MaxTime - MinTime > KINDA_SMALL_NUMBER ? MaxTime - MinTime : 1.0f;
+
+    const FRichCurve& RichCurve = curve.FloatCurve;
+    TSharedRef<const FAdvEasingTable> Table = MakeShared<const FAdvEasingTable>(
+        [&RichCurve, MinTime, TimeSpan](float alpha) { return RichCurve.Eval(MinTime + alpha * TimeSpan); },
+        GetNumEntries(TablePrecision));
+
+    FAdvCurveTableEntry& Entry = CurveTables.FindOrAdd(Key);
+    Entry.Table = Table;
+#if WITH_EDITOR
+    Entry.KeysHash = KeysHash;
+#endif
+
+    return Table;
+}
+
+int32 FAdvEasingTable::GetNumEntries(EEasingPrecision precision)
+{
+    switch (precision)
+    {
+    case EEasingPrecision::Table64:
+        return 64;
+
+    case EEasingPrecision::Table256:
+        return 256;
+
+    case EEasingPrecision::Table1024:
+        return 1024;
+
+    default:
+        return 0;
+    }
+}
@@ -0,0 +1,312 @@
+// Copyright 2025, Wildlight. All Rights Reserved.
+
+#include "AdvReplicatedTweenComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/GameStateBase.h"
+#include "Net/UnrealNetwork.h"
+
+UAdvReplicatedTweenComponent::UAdvReplicatedTweenComponent()
+{
+    PrimaryComponentTick.bCanEverTick = false;
+    SetIsReplicatedByDefault(true);
+}
+
+void UAdvReplicatedTweenComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& outLifetimeProps) const
+{
+    Super::GetLifetimeReplicatedProps(outLifetimeProps);
+
+    DOREPLIFETIME(UAdvReplicatedTweenComponent, ReplicatedTweens);
+}
+
+void UAdvReplicatedTweenComponent::EndPlay(const EEndPlayReason::Type endPlayReason)
+{
+    // Local tweens would otherwise keep driving the owner after the component is gone
+    if (UAdvTweenSubsystem* TweenSubsystem = UAdvTweenSubsystem::Get(this))
+    {
+        for (FTweenHandle& LocalHandle : LocalHandles)
+        {
+            TweenSubsystem->CancelTween(LocalHandle);
+            LocalHandle.Reset();
+        }
+    }
+
+    Super::EndPlay(endPlayReason);
+}
+
+void UAdvReplicatedTweenComponent::ReplicatedMoveTo(FVector desiredLocation, float duration, EEasingFunction easingType)
+{
+    AActor* Owner = GetOwner();
+    if (!Owner || !Owner->HasAuthority())
+    {
+        return;
+    }
+
+    FAdvReplicatedTween Tween;
+    Tween.StartVector = Owner->GetActorLocation();
+    Tween.TargetVector = desiredLocation;
+    Tween.Duration = duration;
+    Tween.EasingType = easingType;
+
+    StartServerTween(ETweenChannel::Location, Tween);
+}
+
+void UAdvReplicatedTweenComponent::ReplicatedRotateTo(FRotator desiredRotation, float duration, EEasingFunction easingType)
+{
+    AActor* Owner = GetOwner();
+    if (!Owner || !Owner->HasAuthority())
+    {
+        return;
+    }
+
+    FAdvReplicatedTween Tween;
+    Tween.StartRotation = Owner->GetActorRotation();
+    Tween.TargetRotation = desiredRotation;
+    Tween.Duration = duration;
+    Tween.EasingType = easingType;
+
+    StartServerTween(ETweenChannel::Rotation, Tween);
+}
+
+void UAdvReplicatedTweenComponent::ReplicatedScaleTo(FVector desiredScale, float duration, EEasingFunction easingType)
+{
+    AActor* Owner = GetOwner();
+    if (!Owner || !Owner->HasAuthority())
+    {
+        return;
+    }
+
+    FAdvReplicatedTween Tween;
+    Tween.StartVector = Owner->GetActorScale3D();
+    Tween.TargetVector = desiredScale;
+    Tween.Duration = duration;
+    Tween.EasingType = easingType;
+
+    StartServerTween(ETweenChannel::Scale, Tween);
+}
+
+void UAdvReplicatedTweenComponent::StopReplicatedTweens()
+{
+    AActor* Owner = GetOwner();
+    if (!Owner || !Owner->HasAuthority() || ActiveChannelMask == 0)
+    {
+        return;
+    }
+
+    UAdvTweenSubsystem* TweenSubsystem = UAdvTweenSubsystem::Get(this);
+
+    for (int32 ChannelIndex = 0; ChannelIndex < static_cast<int32>(UE_ARRAY_COUNT(ReplicatedTweens)); ++ChannelIndex)
+    {
+        if (!(ActiveChannelMask & (1 << ChannelIndex)))
+        {
+            continue;
+        }
+
+        // Bump the sequence first so the cancelled tween's completion is recognised as stale
+        FAdvReplicatedTween& Tween = ReplicatedTweens[ChannelIndex];
+        Tween.bActive = false;
+        Tween.Sequence = NextSequence(Tween.Sequence);
+
+        if (TweenSubsystem)
+        {
+            TweenSubsystem->CancelTween(LocalHandles[ChannelIndex]);
+        }
+        LocalHandles[ChannelIndex].Reset();
+
+        OnTweenFinished.Broadcast(false);
+    }
+
+    ActiveChannelMask = 0;
+    if (bRestoreReplicateMovement)
+    {
+        bRestoreReplicateMovement = false;
+        Owner->SetReplicateMovement(true);
+    }
+    Owner->ForceNetUpdate();
+}
+
+void UAdvReplicatedTweenComponent::StartServerTween(ETweenChannel channel, const FAdvReplicatedTween& tween)
+{
+    AActor* Owner = GetOwner();
+    const int32 ChannelIndex = static_cast<int32>(channel);
+
+    // Record before starting, so a replaced tween finishing inside the start call is already stale
+    FAdvReplicatedTween& Tween = ReplicatedTweens[ChannelIndex];
+    const uint8 Sequence = NextSequence(Tween.Sequence);
+    Tween = tween;
+    Tween.Duration = FMath::Max(0.001f, tween.Duration);
+    Tween.ServerStartTime = GetServerTime();
+    Tween.bActive = true;
+    Tween.Sequence = Sequence;
+
+    // Clients simulate the movement from here on, per-frame movement updates would only fight them
+    if (ActiveChannelMask == 0 && Owner->IsReplicatingMovement())
+    {
+        bRestoreReplicateMovement = true;
+        Owner->SetReplicateMovement(false);
+    }
+    ActiveChannelMask |= 1 << ChannelIndex;
+
+    LocalHandles[ChannelIndex] = StartLocalTween(channel, Tween, Sequence);
+
+    // A tween that never started would never finish and release the channel, so undo the start here
+    if (!LocalHandles[ChannelIndex].IsSet())
+    {
+        Tween.bActive = false;
+        Tween.Sequence = NextSequence(Tween.Sequence);
+        ReleaseServerChannel(ChannelIndex);
+        OnTweenFinished.Broadcast(false);
+    }
+
+    Owner->ForceNetUpdate();
+}
+
+void UAdvReplicatedTweenComponent::OnRep_ReplicatedTweens()
+{
+    for (int32 ChannelIndex = 0; ChannelIndex < static_cast<int32>(UE_ARRAY_COUNT(ReplicatedTweens)); ++ChannelIndex)
+    {
+        if (ReplicatedTweens[ChannelIndex].Sequence != AppliedSequences[ChannelIndex])
+        {
+            AppliedSequences[ChannelIndex] = ReplicatedTweens[ChannelIndex].Sequence;
+            StartClientTween(static_cast<ETweenChannel>(ChannelIndex));
+        }
+    }
+}
+
+void UAdvReplicatedTweenComponent::StartClientTween(ETweenChannel channel)
+{
+    AActor* Owner = GetOwner();
+    UAdvTweenSubsystem* TweenSubsystem = UAdvTweenSubsystem::Get(this);
+    if (!Owner || !TweenSubsystem)
+    {
+        return;
+    }
+
+    const int32 ChannelIndex = static_cast<int32>(channel);
+    const FAdvReplicatedTween& Tween = ReplicatedTweens[ChannelIndex];
+
+    // Whatever this channel played before is superseded; its completion is stale now
+    const bool bWasPlaying = TweenSubsystem->CancelTween(LocalHandles[ChannelIndex]);
+    LocalHandles[ChannelIndex].Reset();
+
+    // Interrupted on the server, movement replication brings the final transform
+    if (!Tween.bActive)
+    {
+        if (bWasPlaying)
+        {
+            OnTweenFinished.Broadcast(false);
+        }
+        return;
+    }
+
+    // Late joiners and long hitches land directly on the end value
+    const float ElapsedTime = static_cast<float>(FMath::Max(0.0, GetServerTime() - Tween.ServerStartTime));
+    const bool bAlreadyFinished = ElapsedTime >= Tween.Duration;
+
+    switch (channel)
+    {
+    case ETweenChannel::Location:
+        Owner->SetActorLocation(bAlreadyFinished ? Tween.TargetVector : Tween.StartVector);
+        break;
+
+    case ETweenChannel::Rotation:
+        Owner->SetActorRotation(bAlreadyFinished ? Tween.TargetRotation : Tween.StartRotation);
+        break;
+
+    case ETweenChannel::Scale:
+        Owner->SetActorScale3D(bAlreadyFinished ? Tween.TargetVector : Tween.StartVector);
+        break;
+    }
+
+    if (bAlreadyFinished)
+    {
+        return;
+    }
+
+    // Fast-forward to where the server is now, the curve is the same one the server evaluates
+    LocalHandles[ChannelIndex] = StartLocalTween(channel, Tween, Tween.Sequence);
+    TweenSubsystem->SetTweenTime(LocalHandles[ChannelIndex], ElapsedTime);
+}
+
+FTweenHandle UAdvReplicatedTweenComponent::StartLocalTween(ETweenChannel channel, const FAdvReplicatedTween& tween, int32 sequence)
+{
+    AActor* Owner = GetOwner();
+    UAdvTweenSubsystem* TweenSubsystem = UAdvTweenSubsystem::Get(this);
+    if (!TweenSubsystem)
+    {
+        return FTweenHandle();
+    }
+
+    FOnAdvTweenFinished OnFinished = FOnAdvTweenFinished::CreateUObject(
+        this, &UAdvReplicatedTweenComponent::HandleTweenFinished, static_cast<int32>(channel), sequence);
+
+    switch (channel)
+    {
+    case ETweenChannel::Location:
+        return TweenSubsystem->StartLocationTween(
+            Owner, tween.TargetVector, tween.Duration, EMoveTimingMode::Duration, tween.EasingType,
+            false, EThreadingType::GameThread, ETweenConflictPolicy::Replace, MoveTemp(OnFinished));
+
+    case ETweenChannel::Rotation:
+        return TweenSubsystem->StartRotationTween(
+            Owner, tween.TargetRotation, tween.Duration, EMoveTimingMode::Duration, tween.EasingType,
+            true, EThreadingType::GameThread, ETweenConflictPolicy::Replace, MoveTemp(OnFinished));
+
+    case ETweenChannel::Scale:
+        return TweenSubsystem->StartScaleTween(
+            Owner, tween.TargetVector, tween.Duration, tween.EasingType,
+            EThreadingType::GameThread, ETweenConflictPolicy::Replace, MoveTemp(OnFinished));
+    }
+
+    return FTweenHandle();
+}
+
+void UAdvReplicatedTweenComponent::HandleTweenFinished(bool bSuccess, int32 channelIndex, int32 sequence)
+{
+    FAdvReplicatedTween& Tween = ReplicatedTweens[channelIndex];
+    if (Tween.Sequence != sequence)
+    {
+        return;
+    }
+
+    LocalHandles[channelIndex].Reset();
+
+    AActor* Owner = GetOwner();
+    if (Owner && Owner->HasAuthority())
+    {
+        // Clients cannot know about an interruption unless it is replicated
+        if (!bSuccess)
+        {
+            Tween.bActive = false;
+            Tween.Sequence = NextSequence(Tween.Sequence);
+        }
+
+        ReleaseServerChannel(channelIndex);
+        Owner->ForceNetUpdate();
+    }
+
+    OnTweenFinished.Broadcast(bSuccess);
+}
+
+void UAdvReplicatedTweenComponent::ReleaseServerChannel(int32 channelIndex)
+{
+    // Resuming movement replication sends the final transform to everyone
+    ActiveChannelMask &= ~(1 << channelIndex);
+    if (ActiveChannelMask == 0 && bRestoreReplicateMovement)
+    {
+        bRestoreReplicateMovement = false;
+        GetOwner()->SetReplicateMovement(true);
+    }
+}
+
+double UAdvReplicatedTweenComponent::GetServerTime() const
+{
+    const UWorld* World = GetWorld();
+    if (!World)
+    {
+        return 0.0;
+    }
+
+    const AGameStateBase* GameState = World->GetGameState();
+    return GameState ? GameState->GetServerWorldTimeSeconds() : World->GetTimeSeconds();
+}
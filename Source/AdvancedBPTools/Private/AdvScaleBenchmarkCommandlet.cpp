@@ -0,0 +1,72 @@
+// Copyright 2025, Wildlight. All Rights Reserved.
+
+#include "AdvScaleBenchmarkCommandlet.h"
+#include "AdvBenchmark.h"
+#include "Engine/World.h"
+#include "Misc/FileHelper.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAdvScaleBenchmark, Log, All);
+
+UAdvScaleBenchmarkCommandlet::UAdvScaleBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+
+    HelpDescription = TEXT("Runs 1k/10k/100k concurrent async move, rotate and scale tweens in a headless world and writes the results as CSV");
+    HelpUsage = TEXT("-run=AdvScaleBenchmark -nullrhi [-Counts=1000,10000,100000] [-Frames=120] [-Output=<file.csv>] [-Easing]");
+}
+
+int32 UAdvScaleBenchmarkCommandlet::Main(const FString& params)
+{
+    // Easing microbenchmarks and accuracy checks need no world; a precision regression fails the run
+    if (FParse::Param(*params, TEXT("Easing")))
+    {
+        FAdvBenchmark::LogResult(FAdvBenchmark::RunEasing(1000000), *GLog);
+        return FAdvBenchmark::LogResult(FAdvBenchmark::CheckEasingAccuracy(100001), *GLog) ? 0 : 1;
+    }
+
+    // Parse options
+    FString CountsString = TEXT("1000,10000,100000");
+    FParse::Value(*params, TEXT("Counts="), CountsString, false);
+
+    TArray<FString> CountStrings;
+    CountsString.ParseIntoArray(CountStrings, TEXT(","));
+
+    TArray<int32> TweenCounts;
+    for (const FString& CountString : CountStrings)
+    {
+        TweenCounts.Add(FCString::Atoi(*CountString));
+    }
+
+    int32 NumFrames = 120;
+    FParse::Value(*params, TEXT("Frames="), NumFrames);
+
+    FString OutputPath = FAdvBenchmark::GetDefaultScaleCsvPath();
+    FParse::Value(*params, TEXT("Output="), OutputPath);
+
+    UWorld* World = TweenCounts.Num() > 0 ? FAdvBenchmark::CreateBenchmarkWorld() : nullptr;
+    if (!World)
+    {
+        UE_LOG(LogAdvScaleBenchmark, Error, TEXT("Nothing to run, check -Counts="));
+        return 1;
+    }
+
+    const TArray<FString> Rows = FAdvBenchmark::ToCsvRows(FAdvBenchmark::RunScaleSuite(World, TweenCounts, NumFrames));
+    FAdvBenchmark::DestroyBenchmarkWorld(World);
+
+    for (const FString& Row : Rows)
+    {
+        UE_LOG(LogAdvScaleBenchmark, Display, TEXT("%s"), *Row);
+    }
+
+    if (!FFileHelper::SaveStringArrayToFile(Rows, *OutputPath))
+    {
+        UE_LOG(LogAdvScaleBenchmark, Error, TEXT("Could not write %s"), *OutputPath);
+        return 1;
+    }
+
+    UE_LOG(LogAdvScaleBenchmark, Display, TEXT("Wrote %s"), *OutputPath);
+    return 0;
+}
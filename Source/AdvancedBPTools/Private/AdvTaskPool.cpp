@@ -0,0 +1,97 @@
+// Copyright 2025, Wildlight. All Rights Reserved.
+
+#include "AdvTaskPool.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+namespace
+{
+    int32 GTaskPoolMaxIdle = 256;
+    FAutoConsoleVariableRef CVarTaskPoolMaxIdle(
+        TEXT("AdvBPTools.TaskPool.MaxIdle"),
+        GTaskPoolMaxIdle,
+        TEXT("Maximum number of idle async task objects kept per task class and world. 0 disables pooling."),
+        ECVF_Default);
+}
+
+UAdvTaskPoolSubsystem* UAdvTaskPoolSubsystem::Get(const UObject* worldContextObject)
+{
+    UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(worldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+    return World ? World->GetSubsystem<UAdvTaskPoolSubsystem>() : nullptr;
+}
+
+UBlueprintAsyncActionBase* UAdvTaskPoolSubsystem::Acquire(UClass* taskClass)
+{
+    if (FAdvTaskPoolBucket* Bucket = Buckets.Find(taskClass))
+    {
+        while (Bucket->IdleTasks.Num() > 0)
+        {
+            UBlueprintAsyncActionBase* Task = Bucket->IdleTasks.Pop(EAllowShrinking::No);
+            if (IsValid(Task))
+            {
+                // Restore what a freshly constructed action has, SetReadyToDestroy cleared it
+                Task->SetFlags(RF_StrongRefOnFrame);
+                ++Hits;
+                return Task;
+            }
+        }
+    }
+
+    ++Misses;
+    return NewObject<UBlueprintAsyncActionBase>(this, taskClass);
+}
+
+void UAdvTaskPoolSubsystem::Release(UBlueprintAsyncActionBase* task)
+{
+    if (!IsValid(task))
+    {
+        return;
+    }
+
+    FAdvTaskPoolBucket& Bucket = Buckets.FindOrAdd(task->GetClass());
+    if (Bucket.IdleTasks.Num() >= GTaskPoolMaxIdle)
+    {
+        ++Discards;
+        return;
+    }
+
+    // A task released twice must not be handed out twice
+    checkSlow(!Bucket.IdleTasks.Contains(task));
+
+    Bucket.IdleTasks.Add(task);
+    ++Releases;
+}
+
+FAdvTaskPoolStats UAdvTaskPoolSubsystem::GetStats() const
+{
+    FAdvTaskPoolStats Stats;
+    Stats.Hits = Hits;
+    Stats.Misses = Misses;
+    Stats.Releases = Releases;
+    Stats.Discards = Discards;
+
+    for (const TPair<TObjectPtr<UClass>, FAdvTaskPoolBucket>& Bucket : Buckets)
+    {
+        Stats.Idle += Bucket.Value.IdleTasks.Num();
+    }
+
+    const int32 Requests = Hits + Misses;
+    Stats.HitRate = Requests > 0 ? static_cast<float>(Hits) / Requests : 0.0f;
+
+    return Stats;
+}
+
+FAdvTaskPoolStats UAdvTaskPoolSubsystem::GetTaskPoolStats(const UObject* worldContextObject)
+{
+    const UAdvTaskPoolSubsystem* TaskPool = Get(worldContextObject);
+    return TaskPool ? TaskPool->GetStats() : FAdvTaskPoolStats();
+}
+
+void UAdvTaskPoolSubsystem::Deinitialize()
+{
+    // Idle tasks go to the garbage collector with the world
+    Buckets.Empty();
+
+    Super::Deinitialize();
+}
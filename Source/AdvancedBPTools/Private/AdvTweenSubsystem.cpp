@@ -0,0 +1,3197 @@
+// Copyright 2025, Wildlight. All Rights Reserved.
+
+#include "AdvTweenSubsystem.h"
+#include "Algo/StableSort.h"
+#include "AdvEasingTable.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "Components/SceneComponent.h"
+#include "Components/SplineComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "Materials/MaterialParameterCollection.h"
+#include "Materials/MaterialParameterCollectionInstance.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "UObject/UnrealType.h"
+
+// stat AdvBPTools: cost of the tween update per phase and what the tweens are doing
+DECLARE_STATS_GROUP(TEXT("AdvBPTools"), STATGROUP_AdvBPTools, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT(TEXT("Tween Update"), STAT_AdvTween_Update, STATGROUP_AdvBPTools);
+DECLARE_CYCLE_STAT(TEXT("Tween Compute"), STAT_AdvTween_Compute, STATGROUP_AdvBPTools);
+DECLARE_CYCLE_STAT(TEXT("Tween Apply"), STAT_AdvTween_Apply, STATGROUP_AdvBPTools);
+DECLARE_CYCLE_STAT(TEXT("Tween Flush"), STAT_AdvTween_Flush, STATGROUP_AdvBPTools);
+DECLARE_CYCLE_STAT(TEXT("Tween Retire"), STAT_AdvTween_Retire, STATGROUP_AdvBPTools);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Actor Location Tweens"), STAT_AdvTween_NumLocation, STATGROUP_AdvBPTools);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Actor Rotation Tweens"), STAT_AdvTween_NumRotation, STATGROUP_AdvBPTools);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Actor Scale Tweens"), STAT_AdvTween_NumScale, STATGROUP_AdvBPTools);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Instance Tweens"), STAT_AdvTween_NumInstance, STATGROUP_AdvBPTools);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Spline Tweens"), STAT_AdvTween_NumSpline, STATGROUP_AdvBPTools);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Keyframe Tweens"), STAT_AdvTween_NumTrack, STATGROUP_AdvBPTools);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Material Parameter Tweens"), STAT_AdvTween_NumParameter, STATGROUP_AdvBPTools);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Property Tweens"), STAT_AdvTween_NumProperty, STATGROUP_AdvBPTools);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Paused Or Queued Tweens"), STAT_AdvTween_NumWaiting, STATGROUP_AdvBPTools);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Sequences"), STAT_AdvTween_NumSequences, STATGROUP_AdvBPTools);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Completions"), STAT_AdvTween_Completions, STATGROUP_AdvBPTools);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Failures"), STAT_AdvTween_Failures, STATGROUP_AdvBPTools);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Actor Writes"), STAT_AdvTween_Writes, STATGROUP_AdvBPTools);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Swept Writes"), STAT_AdvTween_SweptWrites, STATGROUP_AdvBPTools);
+
+CSV_DEFINE_CATEGORY(AdvBPTools, true);
+
+namespace
+{
+    // Tweens evaluated per worker task; large enough to amortize task overhead
+    constexpr int32 ComputeBatchSize = 256;
+
+    int32 GTweenInitialCapacity = 1024;
+    FAutoConsoleVariableRef CVarTweenInitialCapacity(
+        TEXT("AdvBPTools.Tween.InitialCapacity"),
+        GTweenInitialCapacity,
+        TEXT("Number of tweens each world preallocates storage for. Starting tweens beyond this grows the storage."),
+        ECVF_Default);
+
+    bool GTweenDeferMovementUpdates = false;
+    FAutoConsoleVariableRef CVarTweenDeferMovementUpdates(
+        TEXT("AdvBPTools.Tween.DeferMovementUpdates"),
+        GTweenDeferMovementUpdates,
+        TEXT("Default for new tweens: defer their targets' movement updates across the whole flush, so overlaps and attached children are updated once after every tweened transform is written."),
+        ECVF_Default);
+
+    bool GTweenDeferSweptMovement = false;
+    FAutoConsoleVariableRef CVarTweenDeferSweptMovement(
+        TEXT("AdvBPTools.Tween.DeferSweptMovement"),
+        GTweenDeferSweptMovement,
+        TEXT("When deferred movement updates are enabled, also defer writes of actors moved by a sweeping tween. Off by default so sweeps report hits and overlaps immediately."),
+        ECVF_Default);
+
+    // How tweens advance each tick
+    enum class ETweenUpdateMode : int32
+    {
+        PerFrame = 0,
+        FixedStep = 1
+    };
+
+    int32 GTweenUpdateMode = static_cast<int32>(ETweenUpdateMode::PerFrame);
+    FAutoConsoleVariableRef CVarTweenUpdateMode(
+        TEXT("AdvBPTools.Tween.UpdateMode"),
+        GTweenUpdateMode,
+        TEXT("0: advance tweens once per rendered frame by the real frame time. 1: advance in fixed steps of 1/FixedStepRate seconds; frames owing several steps evaluate them as one, frames owing none skip the update."),
+        ECVF_Default);
+
+    float GTweenFixedStepRate = 60.0f;
+    FAutoConsoleVariableRef CVarTweenFixedStepRate(
+        TEXT("AdvBPTools.Tween.FixedStepRate"),
+        GTweenFixedStepRate,
+        TEXT("Steps per second used by the fixed step update mode."),
+        ECVF_Default);
+
+    bool GTweenLodEnabled = false;
+    FAutoConsoleVariableRef CVarTweenLodEnabled(
+        TEXT("AdvBPTools.Tween.LOD.Enable"),
+        GTweenLodEnabled,
+        TEXT("Lowers the update rate of tweens on far away or hidden targets. Completion time and end values are unaffected."),
+        ECVF_Default);
+
+    float GTweenLodReducedDistance = 5000.0f;
+    FAutoConsoleVariableRef CVarTweenLodReducedDistance(
+        TEXT("AdvBPTools.Tween.LOD.ReducedDistance"),
+        GTweenLodReducedDistance,
+        TEXT("Distance to the closest view beyond which tweens update at the reduced rate. 0 disables."),
+        ECVF_Default);
+
+    float GTweenLodCompletionOnlyDistance = 20000.0f;
+    FAutoConsoleVariableRef CVarTweenLodCompletionOnlyDistance(
+        TEXT("AdvBPTools.Tween.LOD.CompletionOnlyDistance"),
+        GTweenLodCompletionOnlyDistance,
+        TEXT("Distance to the closest view beyond which tweens only write their end value when they complete. 0 disables."),
+        ECVF_Default);
+
+    int32 GTweenLodHiddenLevel = 1;
+    FAutoConsoleVariableRef CVarTweenLodHiddenLevel(
+        TEXT("AdvBPTools.Tween.LOD.HiddenLevel"),
+        GTweenLodHiddenLevel,
+        TEXT("LOD level for targets that were not rendered recently. 0: full rate, 1: reduced rate, 2: completion only."),
+        ECVF_Default);
+
+    int32 GTweenLodReducedInterval = 4;
+    FAutoConsoleVariableRef CVarTweenLodReducedInterval(
+        TEXT("AdvBPTools.Tween.LOD.ReducedInterval"),
+        GTweenLodReducedInterval,
+        TEXT("Tweens at the reduced rate are evaluated once every this many updates."),
+        ECVF_Default);
+
+    int32 GTweenLodRefreshInterval = 8;
+    FAutoConsoleVariableRef CVarTweenLodRefreshInterval(
+        TEXT("AdvBPTools.Tween.LOD.RefreshInterval"),
+        GTweenLodRefreshInterval,
+        TEXT("Number of updates over which the LOD level of every tweened target is re-evaluated once."),
+        ECVF_Default);
+
+    // Built-in LOD heuristic shared by actor and instanced component targets
+    ETweenLodLevel EvaluateLodLevel(const FVector& location, float radius, bool bRecentlyRendered, TConstArrayView<FVector> viewLocations)
+    {
+        ETweenLodLevel Level = ETweenLodLevel::Full;
+        if (!bRecentlyRendered)
+        {
+            Level = static_cast<ETweenLodLevel>(FMath::Clamp(GTweenLodHiddenLevel, 0, static_cast<int32>(ETweenLodLevel::CompletionOnly)));
+        }
+
+        // Without views (dedicated servers, the first frame) distance says nothing
+        if (viewLocations.Num() == 0)
+        {
+            return Level;
+        }
+
+        float ClosestDistanceSquared = TNumericLimits<float>::Max();
+        for (const FVector& ViewLocation : viewLocations)
+        {
+            ClosestDistanceSquared = FMath::Min(ClosestDistanceSquared, static_cast<float>(FVector::DistSquared(ViewLocation, location)));
+        }
+        const float Distance = FMath::Max(0.0f, FMath::Sqrt(ClosestDistanceSquared) - radius);
+
+        if (GTweenLodCompletionOnlyDistance > 0.0f && Distance > GTweenLodCompletionOnlyDistance)
+        {
+            return ETweenLodLevel::CompletionOnly;
+        }
+
+        if (GTweenLodReducedDistance > 0.0f && Distance > GTweenLodReducedDistance)
+        {
+            Level = FMath::Max(Level, ETweenLodLevel::Reduced);
+        }
+
+        return Level;
+    }
+
+    float GTweenSplineSampleSpacing = 10.0f;
+    FAutoConsoleVariableRef CVarTweenSplineSampleSpacing(
+        TEXT("AdvBPTools.Tween.SplineSampleSpacing"),
+        GTweenSplineSampleSpacing,
+        TEXT("Distance in units between the arc-length samples taken for spline tweens. Applies to tables built afterwards."),
+        ECVF_Default);
+
+    // Bounds on the number of samples per spline table
+    constexpr int32 MinSplineSamples = 16;
+    constexpr int32 MaxSplineSamples = 16384;
+
+    FORCEINLINE uint8 ChannelBit(ETweenChannel channel)
+    {
+        return static_cast<uint8>(1 << static_cast<uint8>(channel));
+    }
+
+    // Property a property tween can drive and the type it actually has; scalar values drive float and double properties alike
+    const FProperty* FindTweenProperty(const UClass* objectClass, FName propertyName, ETweenPropertyType type, ETweenPropertyType& outType)
+    {
+        const FProperty* Property = FindFProperty<FProperty>(objectClass, propertyName);
+        if (!Property || Property->ArrayDim != 1)
+        {
+            return nullptr;
+        }
+
+        const FStructProperty* StructProperty = CastField<FStructProperty>(Property);
+        const UScriptStruct* Struct = StructProperty ? StructProperty->Struct : nullptr;
+
+        if (Property->IsA<FFloatProperty>())
+        {
+            outType = ETweenPropertyType::Float;
+        }
+        else if (Property->IsA<FDoubleProperty>())
+        {
+            outType = ETweenPropertyType::Double;
+        }
+        else if (Struct && Struct == TBaseStructure<FVector>::Get())
+        {
+            outType = ETweenPropertyType::Vector;
+        }
+        else if (Struct && Struct == TBaseStructure<FRotator>::Get())
+        {
+            outType = ETweenPropertyType::Rotator;
+        }
+        else if (Struct && Struct == TBaseStructure<FLinearColor>::Get())
+        {
+            outType = ETweenPropertyType::LinearColor;
+        }
+        else
+        {
+            return nullptr;
+        }
+
+        const bool bScalar = type == ETweenPropertyType::Float || type == ETweenPropertyType::Double;
+        const bool bScalarProperty = outType == ETweenPropertyType::Float || outType == ETweenPropertyType::Double;
+        return (bScalar ? bScalarProperty : type == outType) ? Property : nullptr;
+    }
+
+    // Typed read of a property value at its address, packed into four doubles
+    FVector4d ReadPropertyValue(const uint8* valuePtr, ETweenPropertyType type)
+    {
+        switch (type)
+        {
+        case ETweenPropertyType::Float:
+            return TAdvTweenPropertyTraits<float>::Pack(*reinterpret_cast<const float*>(valuePtr));
+
+        case ETweenPropertyType::Double:
+            return TAdvTweenPropertyTraits<double>::Pack(*reinterpret_cast<const double*>(valuePtr));
+
+        case ETweenPropertyType::Vector:
+            return TAdvTweenPropertyTraits<FVector>::Pack(*reinterpret_cast<const FVector*>(valuePtr));
+
+        case ETweenPropertyType::Rotator:
+            return TAdvTweenPropertyTraits<FRotator>::Pack(*reinterpret_cast<const FRotator*>(valuePtr));
+
+        case ETweenPropertyType::LinearColor:
+            return TAdvTweenPropertyTraits<FLinearColor>::Pack(*reinterpret_cast<const FLinearColor*>(valuePtr));
+        }
+
+        return FVector4d(0.0, 0.0, 0.0, 0.0);
+    }
+
+    // Typed write of a packed value to a property at its address
+    void WritePropertyValue(uint8* valuePtr, ETweenPropertyType type, const FVector4d& value)
+    {
+        switch (type)
+        {
+        case ETweenPropertyType::Float:
+            *reinterpret_cast<float*>(valuePtr) = TAdvTweenPropertyTraits<float>::Unpack(value);
+            break;
+
+        case ETweenPropertyType::Double:
+            *reinterpret_cast<double*>(valuePtr) = TAdvTweenPropertyTraits<double>::Unpack(value);
+            break;
+
+        case ETweenPropertyType::Vector:
+            *reinterpret_cast<FVector*>(valuePtr) = TAdvTweenPropertyTraits<FVector>::Unpack(value);
+            break;
+
+        case ETweenPropertyType::Rotator:
+            *reinterpret_cast<FRotator*>(valuePtr) = TAdvTweenPropertyTraits<FRotator>::Unpack(value);
+            break;
+
+        case ETweenPropertyType::LinearColor:
+            *reinterpret_cast<FLinearColor*>(valuePtr) = TAdvTweenPropertyTraits<FLinearColor>::Unpack(value);
+            break;
+        }
+    }
+}
+
+UAdvTweenSubsystem* UAdvTweenSubsystem::Get(const UObject* worldContextObject)
+{
+    UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(worldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+    return World ? World->GetSubsystem<UAdvTweenSubsystem>() : nullptr;
+}
+
+FTweenHandle UAdvTweenSubsystem::StartLocationTween(
+    AActor* targetActor,
+    const FVector& desiredLocation,
+    float time,
+    EMoveTimingMode timingMode,
+    EEasingFunction easingType,
+    bool bSweep,
+    EThreadingType threadingType,
+    ETweenConflictPolicy conflictPolicy,
+    FOnAdvTweenFinished&& onFinished)
+{
+    if (!IsValid(targetActor))
+    {
+        return FTweenHandle();
+    }
+
+    ETweenFlags TweenFlags = ETweenFlags::None;
+    TweenFlags |= bSweep ? ETweenFlags::Sweep : ETweenFlags::None;
+    TweenFlags |= timingMode == EMoveTimingMode::Velocity ? ETweenFlags::VelocityTiming : ETweenFlags::None;
+    TweenFlags |= conflictPolicy == ETweenConflictPolicy::Additive ? ETweenFlags::Additive : ETweenFlags::None;
+
+    const int32 Index = AddTween(targetActor, AcquireWriteRecord(targetActor), INDEX_NONE, ETweenChannel::Location, time, easingType, TweenFlags, threadingType, MoveTemp(onFinished));
+    EndVectors[Index] = desiredLocation;
+
+    return ResolveConflict(Index, conflictPolicy);
+}
+
+FTweenHandle UAdvTweenSubsystem::StartRotationTween(
+    AActor* targetActor,
+    const FRotator& desiredRotation,
+    float time,
+    EMoveTimingMode timingMode,
+    EEasingFunction easingType,
+    bool bShortestPath,
+    EThreadingType threadingType,
+    ETweenConflictPolicy conflictPolicy,
+    FOnAdvTweenFinished&& onFinished)
+{
+    if (!IsValid(targetActor))
+    {
+        return FTweenHandle();
+    }
+
+    ETweenFlags TweenFlags = ETweenFlags::None;
+    TweenFlags |= bShortestPath ? ETweenFlags::ShortestPath : ETweenFlags::None;
+    TweenFlags |= timingMode == EMoveTimingMode::Velocity ? ETweenFlags::VelocityTiming : ETweenFlags::None;
+    TweenFlags |= conflictPolicy == ETweenConflictPolicy::Additive ? ETweenFlags::Additive : ETweenFlags::None;
+
+    const int32 Index = AddTween(targetActor, AcquireWriteRecord(targetActor), INDEX_NONE, ETweenChannel::Rotation, time, easingType, TweenFlags, threadingType, MoveTemp(onFinished));
+    EndQuats[Index] = desiredRotation.Quaternion();
+
+    return ResolveConflict(Index, conflictPolicy);
+}
+
+FTweenHandle UAdvTweenSubsystem::StartScaleTween(
+    AActor* targetActor,
+    const FVector& desiredScale,
+    float duration,
+    EEasingFunction easingType,
+    EThreadingType threadingType,
+    ETweenConflictPolicy conflictPolicy,
+    FOnAdvTweenFinished&& onFinished)
+{
+    if (!IsValid(targetActor))
+    {
+        return FTweenHandle();
+    }
+
+    const ETweenFlags TweenFlags = conflictPolicy == ETweenConflictPolicy::Additive ? ETweenFlags::Additive : ETweenFlags::None;
+
+    const int32 Index = AddTween(targetActor, AcquireWriteRecord(targetActor), INDEX_NONE, ETweenChannel::Scale, duration, easingType, TweenFlags, threadingType, MoveTemp(onFinished));
+    EndVectors[Index] = desiredScale;
+
+    return ResolveConflict(Index, conflictPolicy);
+}
+
+FTweenHandle UAdvTweenSubsystem::StartComponentLocationTween(
+    USceneComponent* targetComponent,
+    const FVector& desiredLocation,
+    float time,
+    EMoveTimingMode timingMode,
+    EEasingFunction easingType,
+    bool bSweep,
+    EThreadingType threadingType,
+    ETweenConflictPolicy conflictPolicy,
+    FOnAdvTweenFinished&& onFinished)
+{
+    if (!IsValid(targetComponent))
+    {
+        return FTweenHandle();
+    }
+
+    ETweenFlags TweenFlags = ETweenFlags::None;
+    TweenFlags |= bSweep ? ETweenFlags::Sweep : ETweenFlags::None;
+    TweenFlags |= timingMode == EMoveTimingMode::Velocity ? ETweenFlags::VelocityTiming : ETweenFlags::None;
+    TweenFlags |= conflictPolicy == ETweenConflictPolicy::Additive ? ETweenFlags::Additive : ETweenFlags::None;
+
+    const int32 Index = AddTween(targetComponent, AcquireWriteRecord(targetComponent), INDEX_NONE, ETweenChannel::Location, time, easingType, TweenFlags, threadingType, MoveTemp(onFinished));
+    EndVectors[Index] = desiredLocation;
+
+    return ResolveConflict(Index, conflictPolicy);
+}
+
+FTweenHandle UAdvTweenSubsystem::StartComponentRotationTween(
+    USceneComponent* targetComponent,
+    const FRotator& desiredRotation,
+    float time,
+    EMoveTimingMode timingMode,
+    EEasingFunction easingType,
+    bool bShortestPath,
+    EThreadingType threadingType,
+    ETweenConflictPolicy conflictPolicy,
+    FOnAdvTweenFinished&& onFinished)
+{
+    if (!IsValid(targetComponent))
+    {
+        return FTweenHandle();
+    }
+
+    ETweenFlags TweenFlags = ETweenFlags::None;
+    TweenFlags |= bShortestPath ? ETweenFlags::ShortestPath : ETweenFlags::None;
+    TweenFlags |= timingMode == EMoveTimingMode::Velocity ? ETweenFlags::VelocityTiming : ETweenFlags::None;
+    TweenFlags |= conflictPolicy == ETweenConflictPolicy::Additive ? ETweenFlags::Additive : ETweenFlags::None;
+
+    const int32 Index = AddTween(targetComponent, AcquireWriteRecord(targetComponent), INDEX_NONE, ETweenChannel::Rotation, time, easingType, TweenFlags, threadingType, MoveTemp(onFinished));
+    EndQuats[Index] = desiredRotation.Quaternion();
+
+    return ResolveConflict(Index, conflictPolicy);
+}
+
+FTweenHandle UAdvTweenSubsystem::StartComponentScaleTween(
+    USceneComponent* targetComponent,
+    const FVector& desiredScale,
+    float duration,
+    EEasingFunction easingType,
+    EThreadingType threadingType,
+    ETweenConflictPolicy conflictPolicy,
+    FOnAdvTweenFinished&& onFinished)
+{
+    if (!IsValid(targetComponent))
+    {
+        return FTweenHandle();
+    }
+
+    const ETweenFlags TweenFlags = conflictPolicy == ETweenConflictPolicy::Additive ? ETweenFlags::Additive : ETweenFlags::None;
+
+    const int32 Index = AddTween(targetComponent, AcquireWriteRecord(targetComponent), INDEX_NONE, ETweenChannel::Scale, duration, easingType, TweenFlags, threadingType, MoveTemp(onFinished));
+    EndVectors[Index] = desiredScale;
+
+    return ResolveConflict(Index, conflictPolicy);
+}
+
+FTweenHandle UAdvTweenSubsystem::StartSplineTween(
+    AActor* targetActor,
+    USplineComponent* spline,
+    float time,
+    EMoveTimingMode timingMode,
+    EEasingFunction easingType,
+    bool bOrientToSpline,
+    bool bReverse,
+    EThreadingType threadingType,
+    ETweenConflictPolicy conflictPolicy,
+    FOnAdvTweenFinished&& onFinished)
+{
+    if (!IsValid(targetActor) || !IsValid(spline))
+    {
+        return FTweenHandle();
+    }
+
+    // A path has no offset to add, it always owns the location
+    const ETweenConflictPolicy PathConflictPolicy = conflictPolicy == ETweenConflictPolicy::Additive ? ETweenConflictPolicy::Replace : conflictPolicy;
+
+    ETweenFlags TweenFlags = ETweenFlags::None;
+    TweenFlags |= bOrientToSpline ? ETweenFlags::OrientToPath : ETweenFlags::None;
+    TweenFlags |= timingMode == EMoveTimingMode::Velocity ? ETweenFlags::VelocityTiming : ETweenFlags::None;
+
+    const int32 Index = AddTween(targetActor, AcquireWriteRecord(targetActor), INDEX_NONE, ETweenChannel::Location, time, easingType, TweenFlags, threadingType, MoveTemp(onFinished));
+    SplinePathIndices[Index] = AcquireSplinePath(spline);
+
+    // Negative distances stand for the end of the spline and are resolved when the tween begins
+    StartVectors[Index].X = bReverse ? -1.0f : 0.0f;
+    EndVectors[Index].X = bReverse ? 0.0f : -1.0f;
+
+    return ResolveConflict(Index, PathConflictPolicy);
+}
+
+FTweenHandle UAdvTweenSubsystem::StartKeyframeTween(
+    AActor* targetActor,
+    TConstArrayView<FAdvTransformKey> keys,
+    bool bDriveLocation,
+    bool bDriveRotation,
+    bool bDriveScale,
+    bool bSweep,
+    EThreadingType threadingType,
+    ETweenConflictPolicy conflictPolicy,
+    FOnAdvTweenFinished&& onFinished)
+{
+    if (!IsValid(targetActor) || keys.Num() == 0 || !(bDriveLocation || bDriveRotation || bDriveScale))
+    {
+        return FTweenHandle();
+    }
+
+    // The first driven channel stands for the whole track in conflicts
+    const ETweenChannel PrimaryChannel = bDriveLocation ? ETweenChannel::Location : (bDriveRotation ? ETweenChannel::Rotation : ETweenChannel::Scale);
+    const ETweenConflictPolicy TrackConflictPolicy = conflictPolicy == ETweenConflictPolicy::Additive ? ETweenConflictPolicy::Replace : conflictPolicy;
+    const ETweenFlags TweenFlags = bSweep ? ETweenFlags::Sweep : ETweenFlags::None;
+
+    const int32 Index = AddTween(targetActor, AcquireWriteRecord(targetActor), INDEX_NONE, PrimaryChannel, 0.0f, EEasingFunction::Linear, TweenFlags, threadingType, MoveTemp(onFinished));
+    const int32 TrackIndex = AllocateTrack();
+    TrackIndices[Index] = TrackIndex;
+
+    // Sort once up front so playback only ever walks forward
+    TArray<const FAdvTransformKey*, TInlineAllocator<16>> SortedKeys;
+    for (const FAdvTransformKey& Key : keys)
+    {
+        SortedKeys.Add(&Key);
+    }
+    Algo::StableSortBy(SortedKeys, [](const FAdvTransformKey* key) { return key->Time; });
+
+    FTweenTrack& Track = Tracks[TrackIndex];
+    Track.ChannelMask = (bDriveLocation ? ChannelBit(ETweenChannel::Location) : 0)
+        | (bDriveRotation ? ChannelBit(ETweenChannel::Rotation) : 0)
+        | (bDriveScale ? ChannelBit(ETweenChannel::Scale) : 0);
+
+    for (const FAdvTransformKey* Key : SortedKeys)
+    {
+        Track.Times.Add(FMath::Max(0.0f, Key->Time));
+        Track.Locations.Add(Key->Location);
+        Track.Rotations.Add(Key->Rotation.Quaternion());
+        Track.Scales.Add(Key->Scale);
+        Track.Kernels.Add(UAdvBPUtilities::ResolveEasingKernel(Key->EasingType));
+    }
+
+    return ResolveConflict(Index, TrackConflictPolicy);
+}
+
+FTweenSequenceHandle UAdvTweenSubsystem::StartTweenSequence(
+    AActor* targetActor,
+    TConstArrayView<FAdvTweenStep> steps,
+    bool bSweep,
+    EThreadingType threadingType,
+    FOnAdvTweenFinished&& onFinished)
+{
+    if (!IsValid(targetActor) || steps.Num() == 0)
+    {
+        return FTweenSequenceHandle();
+    }
+
+    const int32 SequenceIndex = FreeSequences.Num() > 0 ? FreeSequences.Pop(EAllowShrinking::No) : Sequences.AddDefaulted();
+    FTweenSequence& Sequence = Sequences[SequenceIndex];
+    Sequence.Actor = targetActor;
+    Sequence.Steps.Append(steps.GetData(), steps.Num());
+    Sequence.OnFinished = MoveTemp(onFinished);
+    Sequence.NextStep = 0;
+    Sequence.ThreadingType = threadingType;
+    Sequence.bSweep = bSweep;
+    Sequence.bActive = true;
+    ++NumActiveSequences;
+
+    FTweenSequenceHandle Handle;
+    Handle.Index = SequenceIndex;
+    Handle.Generation = Sequence.Generation;
+
+    // A sequence of zero length steps completes right here
+    StartSequenceGroup(SequenceIndex, 0.0f);
+    return Handle;
+}
+
+bool UAdvTweenSubsystem::CancelTweenSequence(FTweenSequenceHandle handle)
+{
+    if (!IsTweenSequenceActive(handle))
+    {
+        return false;
+    }
+
+    FinishSequence(handle.Index, false);
+    return true;
+}
+
+bool UAdvTweenSubsystem::IsTweenSequenceActive(FTweenSequenceHandle handle) const
+{
+    return Sequences.IsValidIndex(handle.Index)
+        && Sequences[handle.Index].bActive
+        && Sequences[handle.Index].Generation == handle.Generation;
+}
+
+void UAdvTweenSubsystem::StartSequenceGroup(int32 sequenceIndex, float carryTime)
+{
+    const uint32 Generation = Sequences[sequenceIndex].Generation;
+
+    while (true)
+    {
+        FTweenSequence& Sequence = Sequences[sequenceIndex];
+        AActor* Actor = Sequence.Actor.Get();
+        if (!Actor)
+        {
+            FinishSequence(sequenceIndex, false);
+            return;
+        }
+
+        if (Sequence.NextStep >= Sequence.Steps.Num())
+        {
+            FinishSequence(sequenceIndex, true);
+            return;
+        }
+
+        // A group is a step plus every following step that runs with its predecessor
+        const int32 FirstStep = Sequence.NextStep;
+        int32 EndStep = FirstStep + 1;
+        while (EndStep < Sequence.Steps.Num() && Sequence.Steps[EndStep].bWithPrevious)
+        {
+            ++EndStep;
+        }
+        Sequence.NextStep = EndStep;
+        Sequence.GroupHandles.Reset();
+        Sequence.PendingSteps = 0;
+        Sequence.DelayRemaining = 0.0f;
+        Sequence.DelayStartUpdate = UpdateCounter;
+
+        for (int32 StepIndex = FirstStep; StepIndex < EndStep; ++StepIndex)
+        {
+            // Starting a step can fire completions and grow the sequence array, so nothing is held across it
+            const FAdvTweenStep Step = Sequences[sequenceIndex].Steps[StepIndex];
+            const bool bSweep = Sequences[sequenceIndex].bSweep;
+            const EThreadingType ThreadingType = Sequences[sequenceIndex].ThreadingType;
+
+            if (Step.StepType == ETweenStepType::Delay)
+            {
+                Sequences[sequenceIndex].DelayRemaining = FMath::Max(Sequences[sequenceIndex].DelayRemaining, Step.Duration - carryTime);
+                continue;
+            }
+
+            FOnAdvTweenFinished OnStepFinished = FOnAdvTweenFinished::CreateUObject(
+                this, &UAdvTweenSubsystem::HandleSequenceStepFinished, sequenceIndex, Generation);
+
+            FTweenHandle StepHandle;
+            switch (Step.StepType)
+            {
+            case ETweenStepType::Move:
+            {
+                const FVector TargetLocation = Step.bRelative ? Actor->GetActorLocation() + Step.Vector : Step.Vector;
+                StepHandle = StartLocationTween(Actor, TargetLocation, Step.Duration, EMoveTimingMode::Duration, Step.EasingType,
+                    bSweep, ThreadingType, ETweenConflictPolicy::Replace, MoveTemp(OnStepFinished));
+            }
+            break;
+
+            case ETweenStepType::Rotate:
+            {
+                const FRotator TargetRotation = Step.bRelative ? (Step.Rotation.Quaternion() * Actor->GetActorQuat()).Rotator() : Step.Rotation;
+                StepHandle = StartRotationTween(Actor, TargetRotation, Step.Duration, EMoveTimingMode::Duration, Step.EasingType,
+                    true, ThreadingType, ETweenConflictPolicy::Replace, MoveTemp(OnStepFinished));
+            }
+            break;
+
+            default:
+            {
+                const FVector TargetScale = Step.bRelative ? Actor->GetActorScale3D() * Step.Vector : Step.Vector;
+                StepHandle = StartScaleTween(Actor, TargetScale, Step.Duration, Step.EasingType,
+                    ThreadingType, ETweenConflictPolicy::Replace, MoveTemp(OnStepFinished));
+            }
+            break;
+            }
+
+            // A parallel step replacing another step of the group fails the whole sequence
+            if (!IsTweenSequenceActive(FTweenSequenceHandle{ sequenceIndex, Generation }))
+            {
+                return;
+            }
+
+            // Step tweens start where the group started, not at the beginning of the next update
+            const int32 DenseIndex = FindDenseIndex(StepHandle);
+            if (DenseIndex != INDEX_NONE)
+            {
+                SequenceIndices[DenseIndex] = sequenceIndex;
+                ElapsedTimes[DenseIndex] = FMath::Clamp(carryTime, 0.0f, Durations[DenseIndex]);
+                Sequences[sequenceIndex].GroupHandles.Add(StepHandle);
+                ++Sequences[sequenceIndex].PendingSteps;
+            }
+        }
+
+        FTweenSequence& StartedSequence = Sequences[sequenceIndex];
+        if (StartedSequence.PendingSteps > 0 || StartedSequence.DelayRemaining > 0.0f)
+        {
+            return;
+        }
+
+        // Empty or already elapsed group, the next one starts from the same point in time
+        carryTime = -StartedSequence.DelayRemaining;
+    }
+}
+
+void UAdvTweenSubsystem::HandleSequenceStepFinished(bool bSuccess, int32 sequenceIndex, uint32 generation)
+{
+    if (!IsTweenSequenceActive(FTweenSequenceHandle{ sequenceIndex, generation }))
+    {
+        return;
+    }
+
+    if (!bSuccess)
+    {
+        FinishSequence(sequenceIndex, false);
+        return;
+    }
+
+    FTweenSequence& Sequence = Sequences[sequenceIndex];
+    if (--Sequence.PendingSteps > 0 || Sequence.DelayRemaining > 0.0f)
+    {
+        return;
+    }
+
+    // Steps finishing in the same update hand off the time the longest of them overshot
+    StartSequenceGroup(sequenceIndex, Sequence.CarryUpdate == UpdateCounter ? Sequence.CarryTime : 0.0f);
+}
+
+void UAdvTweenSubsystem::NoteSequenceCarry(int32 sequenceIndex, float overshoot)
+{
+    FTweenSequence& Sequence = Sequences[sequenceIndex];
+    Sequence.CarryTime = Sequence.CarryUpdate == UpdateCounter ? FMath::Min(Sequence.CarryTime, overshoot) : overshoot;
+    Sequence.CarryUpdate = UpdateCounter;
+}
+
+void UAdvTweenSubsystem::FinishSequence(int32 sequenceIndex, bool bSuccess)
+{
+    // Bump the generation first so the cancelled steps' completions are recognised as stale
+    FTweenSequence& Sequence = Sequences[sequenceIndex];
+    TArray<FTweenHandle, TInlineAllocator<3>> GroupHandles = MoveTemp(Sequence.GroupHandles);
+    FOnAdvTweenFinished OnFinished = MoveTemp(Sequence.OnFinished);
+    Sequence.Actor.Reset();
+    Sequence.Steps.Reset();
+    Sequence.GroupHandles.Reset();
+    Sequence.PendingSteps = 0;
+    Sequence.DelayRemaining = 0.0f;
+    Sequence.bActive = false;
+    ++Sequence.Generation;
+    FreeSequences.Add(sequenceIndex);
+    --NumActiveSequences;
+
+    for (const FTweenHandle& GroupHandle : GroupHandles)
+    {
+        CancelTween(GroupHandle);
+    }
+
+    OnFinished.ExecuteIfBound(bSuccess);
+}
+
+void UAdvTweenSubsystem::AdvanceSequenceDelays(float updateTime)
+{
+    // Groups started during this update already accounted for the time they were started with
+    const int32 NumSequences = Sequences.Num();
+    for (int32 SequenceIndex = 0; SequenceIndex < NumSequences; ++SequenceIndex)
+    {
+        FTweenSequence& Sequence = Sequences[SequenceIndex];
+        if (!Sequence.bActive || Sequence.DelayRemaining <= 0.0f || Sequence.DelayStartUpdate == UpdateCounter)
+        {
+            continue;
+        }
+
+        Sequence.DelayRemaining -= updateTime;
+        if (Sequence.DelayRemaining > 0.0f || Sequence.PendingSteps > 0)
+        {
+            continue;
+        }
+
+        // The delay outlasted the group's steps, it hands off whatever it overshot
+        const float DelayCarry = -Sequence.DelayRemaining;
+        const float CarryTime = Sequence.CarryUpdate == UpdateCounter ? FMath::Min(Sequence.CarryTime, DelayCarry) : DelayCarry;
+        StartSequenceGroup(SequenceIndex, CarryTime);
+    }
+}
+
+FTweenHandle UAdvTweenSubsystem::StartInstanceLocationTween(
+    UInstancedStaticMeshComponent* component,
+    int32 instanceIndex,
+    const FVector& desiredLocation,
+    float time,
+    EMoveTimingMode timingMode,
+    EEasingFunction easingType,
+    EThreadingType threadingType,
+    FOnAdvTweenFinished&& onFinished)
+{
+    if (!IsValid(component) || !component->IsValidInstance(instanceIndex))
+    {
+        return FTweenHandle();
+    }
+
+    const ETweenFlags TweenFlags = timingMode == EMoveTimingMode::Velocity ? ETweenFlags::VelocityTiming : ETweenFlags::None;
+
+    const int32 Index = AddTween(component, AcquireInstanceBatch(component), instanceIndex, ETweenChannel::Location, time, easingType, TweenFlags, threadingType, MoveTemp(onFinished));
+    EndVectors[Index] = desiredLocation;
+
+    return BeginInstanceTween(Index);
+}
+
+FTweenHandle UAdvTweenSubsystem::StartInstanceRotationTween(
+    UInstancedStaticMeshComponent* component,
+    int32 instanceIndex,
+    const FRotator& desiredRotation,
+    float time,
+    EMoveTimingMode timingMode,
+    EEasingFunction easingType,
+    bool bShortestPath,
+    EThreadingType threadingType,
+    FOnAdvTweenFinished&& onFinished)
+{
+    if (!IsValid(component) || !component->IsValidInstance(instanceIndex))
+    {
+        return FTweenHandle();
+    }
+
+    ETweenFlags TweenFlags = ETweenFlags::None;
+    TweenFlags |= bShortestPath ? ETweenFlags::ShortestPath : ETweenFlags::None;
+    TweenFlags |= timingMode == EMoveTimingMode::Velocity ? ETweenFlags::VelocityTiming : ETweenFlags::None;
+
+    const int32 Index = AddTween(component, AcquireInstanceBatch(component), instanceIndex, ETweenChannel::Rotation, time, easingType, TweenFlags, threadingType, MoveTemp(onFinished));
+    EndQuats[Index] = desiredRotation.Quaternion();
+
+    return BeginInstanceTween(Index);
+}
+
+FTweenHandle UAdvTweenSubsystem::StartInstanceScaleTween(
+    UInstancedStaticMeshComponent* component,
+    int32 instanceIndex,
+    const FVector& desiredScale,
+    float duration,
+    EEasingFunction easingType,
+    EThreadingType threadingType,
+    FOnAdvTweenFinished&& onFinished)
+{
+    if (!IsValid(component) || !component->IsValidInstance(instanceIndex))
+    {
+        return FTweenHandle();
+    }
+
+    const int32 Index = AddTween(component, AcquireInstanceBatch(component), instanceIndex, ETweenChannel::Scale, duration, easingType, ETweenFlags::None, threadingType, MoveTemp(onFinished));
+    EndVectors[Index] = desiredScale;
+
+    return BeginInstanceTween(Index);
+}
+
+FTweenHandle UAdvTweenSubsystem::BeginInstanceTween(int32 index)
+{
+    const FTweenHandle Handle = MakeHandle(index);
+    const int32 BatchIndex = WriteRecordIndices[index];
+    const int32 OwnerKey = InstanceIndices[index] * 3 + static_cast<int32>(Channels[index]);
+
+    // Instance channels always replace, there are too many of them to keep queues around
+    const FTweenHandle* PreviousOwner = InstanceBatches[BatchIndex].ChannelOwners.Find(OwnerKey);
+    const FTweenHandle Replaced = PreviousOwner ? *PreviousOwner : FTweenHandle();
+
+    if (BeginReplacingTweens(Handle, MakeArrayView(&Replaced, 1)) != INDEX_NONE)
+    {
+        InstanceBatches[BatchIndex].ChannelOwners.Add(OwnerKey, Handle);
+    }
+
+    return Handle;
+}
+
+int32 UAdvTweenSubsystem::BeginReplacingTweens(FTweenHandle handle, TConstArrayView<FTweenHandle> replacedHandles)
+{
+    for (const FTweenHandle& ReplacedHandle : replacedHandles)
+    {
+        CancelTween(ReplacedHandle);
+    }
+
+    // Cancellations swap storage around and their handlers may have cancelled this tween too
+    const int32 CurrentIndex = FindDenseIndex(handle);
+    if (CurrentIndex == INDEX_NONE || States[CurrentIndex] != ETweenState::Queued)
+    {
+        return INDEX_NONE;
+    }
+
+    BeginTween(CurrentIndex);
+    return CurrentIndex;
+}
+
+FTweenHandle UAdvTweenSubsystem::ResolveConflict(int32 index, ETweenConflictPolicy conflictPolicy)
+{
+    const FTweenHandle Handle = MakeHandle(index);
+
+    // Additive tweens never own a channel, they layer on whatever drives it
+    if (conflictPolicy == ETweenConflictPolicy::Additive)
+    {
+        BeginTween(index);
+        return Handle;
+    }
+
+    const int32 RecordIndex = WriteRecordIndices[index];
+    const int32 ChannelIndex = static_cast<int32>(Channels[index]);
+    TArray<FTweenHandle> Replaced;
+
+    if (conflictPolicy == ETweenConflictPolicy::Queue)
+    {
+        const FTweenWriteRecord& Record = WriteRecords[RecordIndex];
+        bool bChannelBusy = IsTweenActive(Record.ChannelOwners[ChannelIndex]);
+        for (const FTweenHandle& QueuedHandle : Record.ChannelQueues[ChannelIndex])
+        {
+            bChannelBusy |= IsTweenActive(QueuedHandle);
+        }
+
+        if (bChannelBusy)
+        {
+            WriteRecords[RecordIndex].ChannelQueues[ChannelIndex].Add(Handle);
+            return Handle;
+        }
+    }
+    else
+    {
+        // Replace: drop the queue first so cancelling the owner does not promote it
+        Replaced = MoveTemp(WriteRecords[RecordIndex].ChannelQueues[ChannelIndex]);
+        Replaced.Add(WriteRecords[RecordIndex].ChannelOwners[ChannelIndex]);
+    }
+
+    BeginReplacingTweens(Handle, Replaced);
+    return Handle;
+}
+
+void UAdvTweenSubsystem::BeginTween(int32 index)
+{
+    States[index] = ETweenState::Running;
+
+    // Parameter tweens start from the parameter's current value and have no transform channel to own
+    if (ParameterIndices[index] != INDEX_NONE)
+    {
+        FTweenParameter& Parameter = Parameters[ParameterIndices[index]];
+        Parameter.StartValue = Parameter.EndValue;
+        GetParameterValue(index, Parameter.StartValue);
+        Parameter.Value = Parameter.StartValue;
+        Durations[index] = FMath::Max(0.001f, Durations[index]);
+        return;
+    }
+
+    // Property tweens read their start straight from the resolved property
+    if (PropertyIndices[index] != INDEX_NONE)
+    {
+        FTweenProperty& Property = Properties[PropertyIndices[index]];
+        if (UObject* Object = Targets[index].Get())
+        {
+            Property.StartValue = ReadPropertyValue(Property.Property->ContainerPtrToValuePtr<uint8>(Object), Property.Type);
+        }
+        Property.Value = Property.StartValue;
+        Durations[index] = FMath::Max(0.001f, Durations[index]);
+        return;
+    }
+
+    FTransform CurrentTransform;
+    if (!GetTargetTransform(index, CurrentTransform))
+    {
+        // The apply phase reports the failure
+        return;
+    }
+
+    const ETweenFlags TweenFlags = Flags[index];
+    const bool bAdditive = EnumHasAnyFlags(TweenFlags, ETweenFlags::Additive);
+    const bool bVelocityTiming = EnumHasAnyFlags(TweenFlags, ETweenFlags::VelocityTiming);
+
+    switch (Channels[index])
+    {
+    case ETweenChannel::Location:
+    {
+        if (SplinePathIndices[index] != INDEX_NONE)
+        {
+            const float PathLength = SplinePaths[SplinePathIndices[index]].Length;
+            StartVectors[index].X = StartVectors[index].X < 0.0f ? PathLength : StartVectors[index].X;
+            EndVectors[index].X = EndVectors[index].X < 0.0f ? PathLength : EndVectors[index].X;
+
+            // Velocity is a speed along the spline, not a straight-line speed
+            if (bVelocityTiming)
+            {
+                const float PathDistance = FMath::Abs(EndVectors[index].X - StartVectors[index].X);
+                Durations[index] = Durations[index] > KINDA_SMALL_NUMBER ? PathDistance / Durations[index] : 0.001f;
+            }
+            break;
+        }
+
+        const FVector StartLocation = CurrentTransform.GetLocation();
+        if (bVelocityTiming)
+        {
+            Durations[index] = CalculateDurationFromVelocity(StartLocation, EndVectors[index], Durations[index]);
+        }
+
+        StartVectors[index] = bAdditive ? FVector::ZeroVector : StartLocation;
+        EndVectors[index] = bAdditive ? EndVectors[index] - StartLocation : EndVectors[index];
+        AppliedVectors[index] = FVector::ZeroVector;
+    }
+    break;
+
+    case ETweenChannel::Rotation:
+    {
+        const FQuat StartQuat = CurrentTransform.GetRotation();
+        FQuat TargetQuat = EndQuats[index];
+
+        if (bVelocityTiming)
+        {
+            Durations[index] = CalculateDurationFromAngularVelocity(StartQuat.Rotator(), TargetQuat.Rotator(), Durations[index]);
+        }
+
+        // Ensure we're using the shortest path if requested
+        if (EnumHasAnyFlags(TweenFlags, ETweenFlags::ShortestPath) && !FMath::IsNearlyEqual(StartQuat | TargetQuat, 0.0f, KINDA_SMALL_NUMBER))
+        {
+            if ((StartQuat | TargetQuat) < 0.0f)
+            {
+                TargetQuat = -TargetQuat;
+            }
+        }
+
+        // Additive rotations run from identity to the world-space delta
+        StartQuats[index] = bAdditive ? FQuat::Identity : StartQuat;
+        EndQuats[index] = bAdditive ? TargetQuat * StartQuat.Inverse() : TargetQuat;
+        AppliedQuats[index] = FQuat::Identity;
+    }
+    break;
+
+    case ETweenChannel::Scale:
+    {
+        const FVector StartScale = CurrentTransform.GetScale3D();
+        StartVectors[index] = bAdditive ? FVector::ZeroVector : StartScale;
+        EndVectors[index] = bAdditive ? EndVectors[index] - StartScale : EndVectors[index];
+        AppliedVectors[index] = FVector::ZeroVector;
+    }
+    break;
+    }
+
+    // Tracks run until their last key
+    if (TrackIndices[index] != INDEX_NONE)
+    {
+        FTweenTrack& Track = Tracks[TrackIndices[index]];
+        Track.Begin(CurrentTransform);
+        Durations[index] = Track.Times.Last();
+    }
+
+    Durations[index] = FMath::Max(0.001f, Durations[index]);
+
+    // An absolute tween takes over its channel; additive offsets so far are now part of its start value
+    if (!bAdditive && InstanceIndices[index] == INDEX_NONE)
+    {
+        FTweenWriteRecord& Record = WriteRecords[WriteRecordIndices[index]];
+        Record.ChannelOwners[static_cast<int32>(Channels[index])] = MakeHandle(index);
+
+        switch (Channels[index])
+        {
+        case ETweenChannel::Location:
+            Record.AccumulatedLocation = FVector::ZeroVector;
+            break;
+
+        case ETweenChannel::Rotation:
+            Record.AccumulatedRotation = FQuat::Identity;
+            break;
+
+        case ETweenChannel::Scale:
+            Record.AccumulatedScale = FVector::ZeroVector;
+            break;
+        }
+    }
+}
+
+bool UAdvTweenSubsystem::GetTargetTransform(int32 index, FTransform& outTransform) const
+{
+    UObject* Target = Targets[index].Get();
+    if (!IsValid(Target))
+    {
+        return false;
+    }
+
+    if (InstanceIndices[index] != INDEX_NONE)
+    {
+        UInstancedStaticMeshComponent* Component = CastChecked<UInstancedStaticMeshComponent>(Target);
+        return Component->GetInstanceTransform(InstanceIndices[index], outTransform, true);
+    }
+
+    // Component tweens run in their parent's space
+    if (const USceneComponent* Component = Cast<USceneComponent>(Target))
+    {
+        outTransform = Component->GetRelativeTransform();
+        return true;
+    }
+
+    outTransform = CastChecked<AActor>(Target)->GetActorTransform();
+    return true;
+}
+
+void UAdvTweenSubsystem::StartQueuedTweens()
+{
+    while (PendingPromotions.Num() > 0)
+    {
+        const TPair<int32, ETweenChannel> Promotion = PendingPromotions.Pop(EAllowShrinking::No);
+        const int32 ChannelIndex = static_cast<int32>(Promotion.Value);
+
+        if (!WriteRecords.IsValidIndex(Promotion.Key) || WriteRecords[Promotion.Key].RefCount == 0
+            || IsTweenActive(WriteRecords[Promotion.Key].ChannelOwners[ChannelIndex]))
+        {
+            continue;
+        }
+
+        // Skip queued tweens that were cancelled while waiting
+        TArray<FTweenHandle>& Queue = WriteRecords[Promotion.Key].ChannelQueues[ChannelIndex];
+        while (Queue.Num() > 0)
+        {
+            const FTweenHandle Next = Queue[0];
+            Queue.RemoveAt(0, 1, EAllowShrinking::No);
+
+            const int32 NextIndex = FindDenseIndex(Next);
+            if (NextIndex != INDEX_NONE && States[NextIndex] == ETweenState::Queued)
+            {
+                BeginTween(NextIndex);
+                break;
+            }
+        }
+    }
+}
+
+void UAdvTweenSubsystem::SetLodCallback(FOnAdvTweenLod&& lodCallback)
+{
+    LodCallback = MoveTemp(lodCallback);
+}
+
+void UAdvTweenSubsystem::RefreshLodLevels()
+{
+    // Each target is re-evaluated once per refresh interval, spread evenly over the updates in between
+    const uint32 RefreshInterval = static_cast<uint32>(FMath::Max(1, GTweenLodRefreshInterval));
+    const TConstArrayView<FVector> ViewLocations = GetWorld()->ViewLocationsRenderedLastFrame;
+
+    for (int32 RecordIndex = 0; RecordIndex < WriteRecords.Num(); ++RecordIndex)
+    {
+        FTweenWriteRecord& Record = WriteRecords[RecordIndex];
+        if (Record.RefCount == 0 || (UpdateCounter + RecordIndex) % RefreshInterval != 0)
+        {
+            continue;
+        }
+
+        // Components are measured from where they are, but rendered as part of their owner
+        const USceneComponent* TargetComponent = Record.Component.Get();
+        const AActor* TargetActor = TargetComponent ? TargetComponent->GetOwner() : Record.Actor.Get();
+        if (!TargetActor)
+        {
+            continue;
+        }
+
+        const FVector TargetLocation = TargetComponent ? TargetComponent->GetComponentLocation() : TargetActor->GetActorLocation();
+        Record.LodLevel = LodCallback.IsBound()
+            ? LodCallback.Execute(TargetComponent ? static_cast<const UObject*>(TargetComponent) : TargetActor)
+            : EvaluateLodLevel(TargetLocation, 0.0f, TargetActor->WasRecentlyRendered(), ViewLocations);
+    }
+
+    for (int32 BatchIndex = 0; BatchIndex < InstanceBatches.Num(); ++BatchIndex)
+    {
+        FTweenInstanceBatch& Batch = InstanceBatches[BatchIndex];
+        if (Batch.RefCount == 0 || (UpdateCounter + BatchIndex) % RefreshInterval != 0)
+        {
+            continue;
+        }
+
+        const UInstancedStaticMeshComponent* Component = Batch.Component.Get();
+        if (!Component)
+        {
+            continue;
+        }
+
+        // A whole component shares one level, measured to its bounds rather than its pivot
+        Batch.LodLevel = LodCallback.IsBound()
+            ? LodCallback.Execute(Component)
+            : EvaluateLodLevel(Component->Bounds.Origin, Component->Bounds.SphereRadius, Component->WasRecentlyRendered(), ViewLocations);
+    }
+
+    for (int32 BatchIndex = 0; BatchIndex < ParameterBatches.Num(); ++BatchIndex)
+    {
+        FTweenParameterBatch& Batch = ParameterBatches[BatchIndex];
+        if (Batch.RefCount == 0 || (UpdateCounter + BatchIndex) % RefreshInterval != 0)
+        {
+            continue;
+        }
+
+        // Collections are seen everywhere, they always update at full rate
+        const UPrimitiveComponent* Component = Cast<UPrimitiveComponent>(Batch.Target.Get());
+        if (!Component)
+        {
+            continue;
+        }
+
+        Batch.LodLevel = LodCallback.IsBound()
+            ? LodCallback.Execute(Component)
+            : EvaluateLodLevel(Component->Bounds.Origin, Component->Bounds.SphereRadius, Component->WasRecentlyRendered(), ViewLocations);
+    }
+}
+
+FTweenHandle UAdvTweenSubsystem::StartPrimitiveDataScalarTween(
+    UPrimitiveComponent* component,
+    int32 dataIndex,
+    float desiredValue,
+    float duration,
+    EEasingFunction easingType,
+    EThreadingType threadingType,
+    FOnAdvTweenFinished&& onFinished)
+{
+    if (!IsValid(component) || dataIndex < 0 || dataIndex >= FCustomPrimitiveData::NumCustomPrimitiveDataFloats)
+    {
+        return FTweenHandle();
+    }
+
+    return StartParameterTween(component, NAME_None, dataIndex, 1, FLinearColor(desiredValue, 0.0f, 0.0f, 0.0f), duration, easingType, threadingType, MoveTemp(onFinished));
+}
+
+FTweenHandle UAdvTweenSubsystem::StartPrimitiveDataVectorTween(
+    UPrimitiveComponent* component,
+    int32 dataIndex,
+    const FLinearColor& desiredValue,
+    float duration,
+    EEasingFunction easingType,
+    EThreadingType threadingType,
+    FOnAdvTweenFinished&& onFinished)
+{
+    if (!IsValid(component) || dataIndex < 0 || dataIndex + 4 > FCustomPrimitiveData::NumCustomPrimitiveDataFloats)
+    {
+        return FTweenHandle();
+    }
+
+    return StartParameterTween(component, NAME_None, dataIndex, 4, desiredValue, duration, easingType, threadingType, MoveTemp(onFinished));
+}
+
+FTweenHandle UAdvTweenSubsystem::StartCollectionScalarTween(
+    UMaterialParameterCollection* collection,
+    FName parameterName,
+    float desiredValue,
+    float duration,
+    EEasingFunction easingType,
+    EThreadingType threadingType,
+    FOnAdvTweenFinished&& onFinished)
+{
+    if (!IsValid(collection) || parameterName.IsNone())
+    {
+        return FTweenHandle();
+    }
+
+    // Scalars and vectors of a collection are owned separately, by their position in the collection
+    const int32 ParameterIndex = collection->ScalarParameters.IndexOfByPredicate([parameterName](const FCollectionScalarParameter& parameter)
+    {
+        return parameter.ParameterName == parameterName;
+    });
+    if (ParameterIndex == INDEX_NONE)
+    {
+        return FTweenHandle();
+    }
+
+    return StartParameterTween(collection, parameterName, ParameterIndex * 2, 1, FLinearColor(desiredValue, 0.0f, 0.0f, 0.0f), duration, easingType, threadingType, MoveTemp(onFinished));
+}
+
+FTweenHandle UAdvTweenSubsystem::StartCollectionVectorTween(
+    UMaterialParameterCollection* collection,
+    FName parameterName,
+    const FLinearColor& desiredValue,
+    float duration,
+    EEasingFunction easingType,
+    EThreadingType threadingType,
+    FOnAdvTweenFinished&& onFinished)
+{
+    if (!IsValid(collection) || parameterName.IsNone())
+    {
+        return FTweenHandle();
+    }
+
+    const int32 ParameterIndex = collection->VectorParameters.IndexOfByPredicate([parameterName](const FCollectionVectorParameter& parameter)
+    {
+        return parameter.ParameterName == parameterName;
+    });
+    if (ParameterIndex == INDEX_NONE)
+    {
+        return FTweenHandle();
+    }
+
+    return StartParameterTween(collection, parameterName, ParameterIndex * 2 + 1, 4, desiredValue, duration, easingType, threadingType, MoveTemp(onFinished));
+}
+
+FTweenHandle UAdvTweenSubsystem::StartParameterTween(
+    UObject* target,
+    FName parameterName,
+    int32 dataIndex,
+    int32 numValues,
+    const FLinearColor& desiredValue,
+    float duration,
+    EEasingFunction easingType,
+    EThreadingType threadingType,
+    FOnAdvTweenFinished&& onFinished)
+{
+    // The channel is unused, parameter tweens evaluate into their parameter entry
+    const int32 Index = AddTween(target, AcquireParameterBatch(target), INDEX_NONE, ETweenChannel::Location, duration, easingType, ETweenFlags::None, threadingType, MoveTemp(onFinished));
+    ParameterIndices[Index] = AllocateParameter();
+
+    FTweenParameter& Parameter = Parameters[ParameterIndices[Index]];
+    Parameter.ParameterName = parameterName;
+    Parameter.DataIndex = dataIndex;
+    Parameter.NumValues = numValues;
+    Parameter.EndValue = desiredValue;
+
+    const FTweenHandle Handle = MakeHandle(Index);
+    const int32 BatchIndex = WriteRecordIndices[Index];
+
+    // Parameters always replace, like instance channels, including tweens that only overlap some of the floats
+    const int32 OwnerKeyEnd = dataIndex + Parameter.GetNumOwnerKeys();
+    TArray<FTweenHandle, TInlineAllocator<4>> Replaced;
+    for (int32 OwnerKey = dataIndex; OwnerKey < OwnerKeyEnd; ++OwnerKey)
+    {
+        if (const FTweenHandle* PreviousOwner = ParameterBatches[BatchIndex].ParameterOwners.Find(OwnerKey))
+        {
+            Replaced.AddUnique(*PreviousOwner);
+        }
+    }
+
+    if (BeginReplacingTweens(Handle, Replaced) != INDEX_NONE)
+    {
+        for (int32 OwnerKey = dataIndex; OwnerKey < OwnerKeyEnd; ++OwnerKey)
+        {
+            ParameterBatches[BatchIndex].ParameterOwners.Add(OwnerKey, Handle);
+        }
+    }
+
+    return Handle;
+}
+
+FTweenHandle UAdvTweenSubsystem::StartPropertyTweenPacked(
+    UObject* target,
+    FName propertyName,
+    ETweenPropertyType type,
+    const FVector4d& desiredValue,
+    float duration,
+    EEasingFunction easingType,
+    EThreadingType threadingType,
+    FOnAdvTweenFinished&& onFinished)
+{
+    if (!IsValid(target))
+    {
+        return FTweenHandle();
+    }
+
+    ETweenPropertyType PropertyType;
+    const FProperty* Property = FindTweenProperty(target->GetClass(), propertyName, type, PropertyType);
+    if (!Property)
+    {
+        return FTweenHandle();
+    }
+
+    return AddPropertyTween(target, Property, PropertyType, desiredValue, duration, easingType, threadingType, MoveTemp(onFinished));
+}
+
+TArray<FTweenHandle> UAdvTweenSubsystem::StartPropertyTweensPacked(
+    TConstArrayView<UObject*> targets,
+    FName propertyName,
+    ETweenPropertyType type,
+    const FVector4d& desiredValue,
+    float duration,
+    EEasingFunction easingType,
+    EThreadingType threadingType)
+{
+    TArray<FTweenHandle> Handles;
+    Handles.Reserve(targets.Num());
+
+    // Objects of one class share the lookup, however the array interleaves classes
+    TMap<const UClass*, TPair<const FProperty*, ETweenPropertyType>, TInlineSetAllocator<8>> ResolvedClasses;
+    for (UObject* Target : targets)
+    {
+        if (!IsValid(Target))
+        {
+            Handles.Add(FTweenHandle());
+            continue;
+        }
+
+        const UClass* TargetClass = Target->GetClass();
+        TPair<const FProperty*, ETweenPropertyType>* Resolved = ResolvedClasses.Find(TargetClass);
+        if (!Resolved)
+        {
+            ETweenPropertyType PropertyType = type;
+            const FProperty* Property = FindTweenProperty(TargetClass, propertyName, type, PropertyType);
+            Resolved = &ResolvedClasses.Add(TargetClass, TPair<const FProperty*, ETweenPropertyType>(Property, PropertyType));
+        }
+
+        Handles.Add(Resolved->Key
+            ? AddPropertyTween(Target, Resolved->Key, Resolved->Value, desiredValue, duration, easingType, threadingType, FOnAdvTweenFinished())
+            : FTweenHandle());
+    }
+
+    return Handles;
+}
+
+FTweenHandle UAdvTweenSubsystem::AddPropertyTween(
+    UObject* target,
+    const FProperty* property,
+    ETweenPropertyType propertyType,
+    const FVector4d& desiredValue,
+    float duration,
+    EEasingFunction easingType,
+    EThreadingType threadingType,
+    FOnAdvTweenFinished&& onFinished)
+{
+    // Property tweens have no write record, the channel is unused
+    const int32 Index = AddTween(target, INDEX_NONE, INDEX_NONE, ETweenChannel::Location, duration, easingType, ETweenFlags::None, threadingType, MoveTemp(onFinished));
+    PropertyIndices[Index] = FreeProperties.Num() > 0 ? FreeProperties.Pop(EAllowShrinking::No) : Properties.AddDefaulted();
+
+    FTweenProperty& Property = Properties[PropertyIndices[Index]];
+    Property = FTweenProperty();
+    Property.Property = property;
+    Property.TargetKey = target;
+    Property.Type = propertyType;
+    Property.EndValue = desiredValue;
+
+    const FTweenHandle Handle = MakeHandle(Index);
+    const TPair<TObjectKey<UObject>, const FProperty*> OwnerKey(target, property);
+
+    // Properties always replace, like instance channels
+    const FTweenHandle* PreviousOwner = PropertyOwners.Find(OwnerKey);
+    const FTweenHandle Replaced = PreviousOwner ? *PreviousOwner : FTweenHandle();
+
+    if (BeginReplacingTweens(Handle, MakeArrayView(&Replaced, 1)) != INDEX_NONE)
+    {
+        PropertyOwners.Add(OwnerKey, Handle);
+    }
+
+    return Handle;
+}
+
+void UAdvTweenSubsystem::WritePropertyResult(int32 index)
+{
+    const FTweenProperty& Property = Properties[PropertyIndices[index]];
+    WritePropertyValue(Property.Property->ContainerPtrToValuePtr<uint8>(Targets[index].Get()), Property.Type, Property.Value);
+}
+
+bool UAdvTweenSubsystem::PauseTween(FTweenHandle handle)
+{
+    const int32 Index = FindDenseIndex(handle);
+    if (Index == INDEX_NONE || States[Index] == ETweenState::Cancelled || States[Index] == ETweenState::Queued)
+    {
+        return false;
+    }
+
+    States[Index] = ETweenState::Paused;
+    return true;
+}
+
+bool UAdvTweenSubsystem::ResumeTween(FTweenHandle handle)
+{
+    const int32 Index = FindDenseIndex(handle);
+    if (Index == INDEX_NONE || States[Index] != ETweenState::Paused)
+    {
+        return false;
+    }
+
+    States[Index] = ETweenState::Running;
+    return true;
+}
+
+bool UAdvTweenSubsystem::CancelTween(FTweenHandle handle)
+{
+    const int32 Index = FindDenseIndex(handle);
+    if (Index == INDEX_NONE || States[Index] == ETweenState::Cancelled)
+    {
+        return false;
+    }
+
+    // Mid-update the apply phase retires it, otherwise it can go right away
+    if (bIsUpdating)
+    {
+        States[Index] = ETweenState::Cancelled;
+        return true;
+    }
+
+    FOnAdvTweenFinished OnFinished = MoveTemp(FinishedDelegates[Index]);
+    CountFinishedTween(false);
+    RemoveTweenAtSwap(Index);
+    StartQueuedTweens();
+    OnFinished.ExecuteIfBound(false);
+
+    return true;
+}
+
+bool UAdvTweenSubsystem::IsTweenActive(FTweenHandle handle) const
+{
+    const int32 Index = FindDenseIndex(handle);
+    return Index != INDEX_NONE && States[Index] != ETweenState::Cancelled;
+}
+
+bool UAdvTweenSubsystem::IsTweenPaused(FTweenHandle handle) const
+{
+    const int32 Index = FindDenseIndex(handle);
+    return Index != INDEX_NONE && States[Index] == ETweenState::Paused;
+}
+
+float UAdvTweenSubsystem::GetTweenProgress(FTweenHandle handle) const
+{
+    // Cancelled tweens stay in storage until retired, but are as good as gone
+    const int32 Index = FindDenseIndex(handle);
+    if (Index == INDEX_NONE || States[Index] == ETweenState::Cancelled)
+    {
+        return -1.0f;
+    }
+
+    // Queued tweens have not resolved their duration yet
+    if (States[Index] == ETweenState::Queued)
+    {
+        return 0.0f;
+    }
+
+    return FMath::Min(ElapsedTimes[Index] / Durations[Index], 1.0f);
+}
+
+bool UAdvTweenSubsystem::SetTweenDeferMovementUpdates(FTweenHandle handle, bool bDefer)
+{
+    const int32 Index = FindDenseIndex(handle);
+    if (Index == INDEX_NONE)
+    {
+        return false;
+    }
+
+    Flags[Index] = bDefer ? Flags[Index] | ETweenFlags::DeferMovement : Flags[Index] & ~ETweenFlags::DeferMovement;
+    return true;
+}
+
+bool UAdvTweenSubsystem::SetTweenTime(FTweenHandle handle, float time)
+{
+    const int32 Index = FindDenseIndex(handle);
+    if (Index == INDEX_NONE || States[Index] == ETweenState::Cancelled || States[Index] == ETweenState::Queued)
+    {
+        return false;
+    }
+
+    // The value follows on the next update
+    ElapsedTimes[Index] = FMath::Clamp(time, 0.0f, Durations[Index]);
+    return true;
+}
+
+bool UAdvTweenSubsystem::RetargetTween(FTweenHandle handle, const FVector& newTarget)
+{
+    const int32 Index = FindDenseIndex(handle);
+    if (Index == INDEX_NONE || Channels[Index] == ETweenChannel::Rotation)
+    {
+        return false;
+    }
+
+    return RetargetAtIndex(Index, newTarget, FQuat::Identity);
+}
+
+bool UAdvTweenSubsystem::RetargetTween(FTweenHandle handle, const FRotator& newTarget)
+{
+    const int32 Index = FindDenseIndex(handle);
+    if (Index == INDEX_NONE || Channels[Index] != ETweenChannel::Rotation)
+    {
+        return false;
+    }
+
+    return RetargetAtIndex(Index, FVector::ZeroVector, newTarget.Quaternion());
+}
+
+bool UAdvTweenSubsystem::SetTweenFollowTarget(FTweenHandle handle, AActor* followActor, const FVector& locationOffset)
+{
+    const int32 Index = FindDenseIndex(handle);
+    if (Index == INDEX_NONE || States[Index] == ETweenState::Cancelled || EnumHasAnyFlags(Flags[Index], ETweenFlags::Additive)
+        || SplinePathIndices[Index] != INDEX_NONE || TrackIndices[Index] != INDEX_NONE
+        || ParameterIndices[Index] != INDEX_NONE || PropertyIndices[Index] != INDEX_NONE)
+    {
+        return false;
+    }
+
+    // Component tweens run in relative space, a world-space target would not mean anything to them
+    if (InstanceIndices[Index] == INDEX_NONE && WriteRecords[WriteRecordIndices[Index]].Component.IsValid())
+    {
+        return false;
+    }
+
+    if (RetargetIndices[Index] == INDEX_NONE)
+    {
+        if (!followActor)
+        {
+            return true;
+        }
+
+        RetargetIndices[Index] = FreeRetargets.Num() > 0 ? FreeRetargets.Pop(EAllowShrinking::No) : Retargets.AddDefaulted();
+        Retargets[RetargetIndices[Index]] = FTweenRetarget();
+    }
+
+    FTweenRetarget& Retarget = Retargets[RetargetIndices[Index]];
+    NumFollowing += (followActor ? 1 : 0) - (Retarget.bFollowing ? 1 : 0);
+    Retarget.FollowActor = followActor;
+    Retarget.FollowOffset = locationOffset;
+    Retarget.bFollowing = followActor != nullptr;
+
+    // Force a retarget on the next update even if the followed actor stands still
+    Retarget.LastFollowTransform.SetScale3D(FVector::ZeroVector);
+    return true;
+}
+
+bool UAdvTweenSubsystem::RetargetAtIndex(int32 index, const FVector& newEndVector, const FQuat& newEndQuat)
+{
+    if (States[index] == ETweenState::Cancelled || EnumHasAnyFlags(Flags[index], ETweenFlags::Additive)
+        || SplinePathIndices[index] != INDEX_NONE || TrackIndices[index] != INDEX_NONE
+        || ParameterIndices[index] != INDEX_NONE || PropertyIndices[index] != INDEX_NONE)
+    {
+        return false;
+    }
+
+    const bool bRotation = Channels[index] == ETweenChannel::Rotation;
+
+    // Queued tweens have not captured their start yet, their end value can simply be swapped
+    if (States[index] == ETweenState::Queued)
+    {
+        EndVectors[index] = bRotation ? EndVectors[index] : newEndVector;
+        EndQuats[index] = bRotation ? newEndQuat : EndQuats[index];
+        return true;
+    }
+
+    // Continue from the offset the tween currently has, moving at the rate it currently moves
+    const float Time = FMath::Min(ElapsedTimes[index], Durations[index]);
+    FVector CurrentOffset = FVector::ZeroVector;
+    FVector CurrentVelocity = FVector::ZeroVector;
+    if (RetargetIndices[index] != INDEX_NONE)
+    {
+        Retargets[RetargetIndices[index]].Evaluate(Time, Durations[index], CurrentOffset, CurrentVelocity);
+    }
+    else
+    {
+        RetargetIndices[index] = FreeRetargets.Num() > 0 ? FreeRetargets.Pop(EAllowShrinking::No) : Retargets.AddDefaulted();
+        Retargets[RetargetIndices[index]] = FTweenRetarget();
+    }
+
+    // The offset is measured from the tween's original end value
+    FVector EndOffset = newEndVector - EndVectors[index];
+    if (bRotation)
+    {
+        FQuat OffsetQuat = newEndQuat * EndQuats[index].Inverse();
+        OffsetQuat = OffsetQuat.W < 0.0f ? -OffsetQuat : OffsetQuat;
+        EndOffset = OffsetQuat.ToRotationVector();
+    }
+
+    FTweenRetarget& Retarget = Retargets[RetargetIndices[index]];
+    Retarget.StartOffset = CurrentOffset;
+    Retarget.StartVelocity = CurrentVelocity;
+    Retarget.EndOffset = EndOffset;
+    Retarget.StartTime = Time;
+    return true;
+}
+
+void UAdvTweenSubsystem::UpdateFollowTargets()
+{
+    for (int32 Index = 0; Index < Targets.Num(); ++Index)
+    {
+        if (RetargetIndices[Index] == INDEX_NONE || !Retargets[RetargetIndices[Index]].bFollowing)
+        {
+            continue;
+        }
+
+        // A followed actor that went away leaves the tween heading for where it was last seen
+        FTweenRetarget& Retarget = Retargets[RetargetIndices[Index]];
+        const AActor* FollowActor = Retarget.FollowActor.Get();
+        if (!FollowActor)
+        {
+            continue;
+        }
+
+        const FTransform FollowTransform = FollowActor->GetActorTransform();
+        if (FollowTransform.Equals(Retarget.LastFollowTransform, KINDA_SMALL_NUMBER))
+        {
+            continue;
+        }
+        Retarget.LastFollowTransform = FollowTransform;
+
+        switch (Channels[Index])
+        {
+        case ETweenChannel::Location:
+            RetargetAtIndex(Index, FollowTransform.GetLocation() + Retarget.FollowOffset, FQuat::Identity);
+            break;
+
+        case ETweenChannel::Rotation:
+            RetargetAtIndex(Index, FVector::ZeroVector, FollowTransform.GetRotation());
+            break;
+
+        case ETweenChannel::Scale:
+            RetargetAtIndex(Index, FollowTransform.GetScale3D(), FQuat::Identity);
+            break;
+        }
+    }
+}
+
+void UAdvTweenSubsystem::FTweenRetarget::Evaluate(float time, float duration, FVector& outOffset, FVector& outVelocity) const
+{
+    const float Span = duration - StartTime;
+    if (Span <= KINDA_SMALL_NUMBER)
+    {
+        outOffset = EndOffset;
+        outVelocity = FVector::ZeroVector;
+        return;
+    }
+
+    // Cubic Hermite from (StartOffset, StartVelocity) to (EndOffset, zero velocity) over the remaining time
+    const float S = FMath::Clamp((time - StartTime) / Span, 0.0f, 1.0f);
+    const float S2 = S * S;
+    const float S3 = S2 * S;
+
+    const float H00 = 2.0f * S3 - 3.0f * S2 + 1.0f;
+    const float H10 = S3 - 2.0f * S2 + S;
+    const float H01 = -2.0f * S3 + 3.0f * S2;
+    outOffset = H00 * StartOffset + (H10 * Span) * StartVelocity + H01 * EndOffset;
+
+    const float D00 = 6.0f * S2 - 6.0f * S;
+    const float D10 = 3.0f * S2 - 4.0f * S + 1.0f;
+    const float D01 = -6.0f * S2 + 6.0f * S;
+    outVelocity = (D00 * StartOffset + D01 * EndOffset) / Span + D10 * StartVelocity;
+}
+
+bool UAdvTweenSubsystem::SetTweenEasingCurve(FTweenHandle handle, const UCurveFloat* curve, EEasingPrecision precision)
+{
+    const int32 Index = FindDenseIndex(handle);
+    if (Index == INDEX_NONE)
+    {
+        return false;
+    }
+
+    // Thousands of tweens sharing a curve share one table
+    EasingTables[Index] = curve ? FAdvEasingTable::GetForCurve(*curve, precision).ToSharedPtr() : nullptr;
+    return true;
+}
+
+float UAdvTweenSubsystem::CalculateDurationFromVelocity(
+    const FVector& startLocation,
+    const FVector& targetLocation,
+    float velocity)
+{
+    // Calculate distance between points using optimized SIMD operation
+    const float Distance = FVector::Distance(startLocation, targetLocation);
+
+    // Handle edge cases
+    if (Distance <= KINDA_SMALL_NUMBER || velocity <= KINDA_SMALL_NUMBER)
+    {
+        return 0.001f; // Return minimal duration for immediate completion
+    }
+
+    // Calculate duration from distance and velocity
+    return Distance / velocity;
+}
+
+float UAdvTweenSubsystem::CalculateDurationFromAngularVelocity(
+    const FRotator& startRotation,
+    const FRotator& targetRotation,
+    float degreesPerSecond)
+{
+    // Early validation
+    if (degreesPerSecond <= KINDA_SMALL_NUMBER)
+    {
+        return 0.001f; // Return minimal duration for immediate completion
+    }
+
+    // Convert to quaternions for most accurate angular distance calculation
+    const FQuat StartQuat = startRotation.Quaternion();
+    const FQuat TargetQuat = targetRotation.Quaternion();
+
+    if (StartQuat.Equals(TargetQuat, KINDA_SMALL_NUMBER))
+    {
+        return 0.001f; // Return minimal duration for immediate completion
+    }
+
+    // Get the angular distance in radians
+    const float AngularDistance = StartQuat.AngularDistance(TargetQuat);
+
+    // Convert to degrees and calculate duration
+    const float AngularDistanceDegrees = FMath::RadiansToDegrees(AngularDistance);
+
+    // Calculate duration based on angular velocity
+    return AngularDistanceDegrees / degreesPerSecond;
+}
+
+int32 UAdvTweenSubsystem::AddTween(
+    UObject* target,
+    int32 recordIndex,
+    int32 instanceIndex,
+    ETweenChannel channel,
+    float time,
+    EEasingFunction easingType,
+    ETweenFlags flags,
+    EThreadingType threadingType,
+    FOnAdvTweenFinished&& onFinished)
+{
+    // Reuse a retired slot when one is free, its generation already invalidates old handles
+    const int32 SlotIndex = FreeSlots.Num() > 0 ? FreeSlots.Pop(EAllowShrinking::No) : Slots.AddDefaulted();
+
+    const int32 Index = Targets.Add(target);
+    SlotIndices.Add(SlotIndex);
+    WriteRecordIndices.Add(recordIndex);
+    InstanceIndices.Add(instanceIndex);
+    SplinePathIndices.Add(INDEX_NONE);
+    TrackIndices.Add(INDEX_NONE);
+    SequenceIndices.Add(INDEX_NONE);
+    RetargetIndices.Add(INDEX_NONE);
+    ParameterIndices.Add(INDEX_NONE);
+    PropertyIndices.Add(INDEX_NONE);
+    Channels.Add(channel);
+    States.Add(ETweenState::Queued);
+    Flags.Add(flags | (GTweenDeferMovementUpdates ? ETweenFlags::DeferMovement : ETweenFlags::None));
+    EasingKernels.Add(UAdvBPUtilities::ResolveEasingKernel(easingType));
+    EasingTables.Add(nullptr);
+    ElapsedTimes.Add(0.0f);
+    Durations.Add(time);
+    ThreadingTypes.Add(threadingType);
+    StartVectors.Add(FVector::ZeroVector);
+    EndVectors.Add(FVector::ZeroVector);
+    StartQuats.Add(FQuat::Identity);
+    EndQuats.Add(FQuat::Identity);
+    AppliedVectors.Add(FVector::ZeroVector);
+    AppliedQuats.Add(FQuat::Identity);
+    FinishedDelegates.Add(MoveTemp(onFinished));
+
+    Slots[SlotIndex].DenseIndex = Index;
+
+    return Index;
+}
+
+FTweenHandle UAdvTweenSubsystem::MakeHandle(int32 index) const
+{
+    FTweenHandle Handle;
+    Handle.Index = SlotIndices[index];
+    Handle.Generation = Slots[Handle.Index].Generation;
+    return Handle;
+}
+
+int32 UAdvTweenSubsystem::FindDenseIndex(FTweenHandle handle) const
+{
+    if (!Slots.IsValidIndex(handle.Index))
+    {
+        return INDEX_NONE;
+    }
+
+    const FTweenSlot& Slot = Slots[handle.Index];
+    return Slot.Generation == handle.Generation ? Slot.DenseIndex : INDEX_NONE;
+}
+
+void UAdvTweenSubsystem::RemoveTweenAtSwap(int32 index)
+{
+    const int32 RecordIndex = WriteRecordIndices[index];
+    const ETweenChannel Channel = Channels[index];
+    if (InstanceIndices[index] != INDEX_NONE)
+    {
+        TMap<int32, FTweenHandle>& InstanceOwners = InstanceBatches[RecordIndex].ChannelOwners;
+        const int32 OwnerKey = InstanceIndices[index] * 3 + static_cast<int32>(Channel);
+        const FTweenHandle* Owner = InstanceOwners.Find(OwnerKey);
+        if (Owner && *Owner == MakeHandle(index))
+        {
+            InstanceOwners.Remove(OwnerKey);
+        }
+        ReleaseInstanceBatch(RecordIndex);
+    }
+    else if (ParameterIndices[index] != INDEX_NONE)
+    {
+        TMap<int32, FTweenHandle>& ParameterOwners = ParameterBatches[RecordIndex].ParameterOwners;
+        const FTweenParameter& Parameter = Parameters[ParameterIndices[index]];
+        for (int32 OwnerKey = Parameter.DataIndex; OwnerKey < Parameter.DataIndex + Parameter.GetNumOwnerKeys(); ++OwnerKey)
+        {
+            const FTweenHandle* Owner = ParameterOwners.Find(OwnerKey);
+            if (Owner && *Owner == MakeHandle(index))
+            {
+                ParameterOwners.Remove(OwnerKey);
+            }
+        }
+        ReleaseParameterBatch(RecordIndex);
+        FreeParameters.Add(ParameterIndices[index]);
+    }
+    else if (PropertyIndices[index] != INDEX_NONE)
+    {
+        FTweenProperty& Property = Properties[PropertyIndices[index]];
+        const TPair<TObjectKey<UObject>, const FProperty*> OwnerKey(Property.TargetKey, Property.Property);
+        const FTweenHandle* Owner = PropertyOwners.Find(OwnerKey);
+        if (Owner && *Owner == MakeHandle(index))
+        {
+            PropertyOwners.Remove(OwnerKey);
+        }
+        Property.Property = nullptr;
+        FreeProperties.Add(PropertyIndices[index]);
+    }
+    else
+    {
+        // An owner leaving its channel lets the next queued tween start
+        if (WriteRecords[RecordIndex].ChannelOwners[static_cast<int32>(Channel)] == MakeHandle(index))
+        {
+            PendingPromotions.Emplace(RecordIndex, Channel);
+        }
+        ReleaseWriteRecord(RecordIndex);
+    }
+
+    if (SplinePathIndices[index] != INDEX_NONE)
+    {
+        ReleaseSplinePath(SplinePathIndices[index]);
+    }
+
+    if (TrackIndices[index] != INDEX_NONE)
+    {
+        FreeTracks.Add(TrackIndices[index]);
+    }
+
+    if (RetargetIndices[index] != INDEX_NONE)
+    {
+        FTweenRetarget& Retarget = Retargets[RetargetIndices[index]];
+        NumFollowing -= Retarget.bFollowing ? 1 : 0;
+        Retarget.FollowActor.Reset();
+        Retarget.bFollowing = false;
+        FreeRetargets.Add(RetargetIndices[index]);
+    }
+
+    // Retire the slot so outstanding handles go stale
+    FTweenSlot& RemovedSlot = Slots[SlotIndices[index]];
+    RemovedSlot.DenseIndex = INDEX_NONE;
+    ++RemovedSlot.Generation;
+    FreeSlots.Add(SlotIndices[index]);
+
+    SlotIndices.RemoveAtSwap(index, 1, EAllowShrinking::No);
+    Targets.RemoveAtSwap(index, 1, EAllowShrinking::No);
+    WriteRecordIndices.RemoveAtSwap(index, 1, EAllowShrinking::No);
+    InstanceIndices.RemoveAtSwap(index, 1, EAllowShrinking::No);
+    SplinePathIndices.RemoveAtSwap(index, 1, EAllowShrinking::No);
+    TrackIndices.RemoveAtSwap(index, 1, EAllowShrinking::No);
+    SequenceIndices.RemoveAtSwap(index, 1, EAllowShrinking::No);
+    RetargetIndices.RemoveAtSwap(index, 1, EAllowShrinking::No);
+    ParameterIndices.RemoveAtSwap(index, 1, EAllowShrinking::No);
+    PropertyIndices.RemoveAtSwap(index, 1, EAllowShrinking::No);
+    Channels.RemoveAtSwap(index, 1, EAllowShrinking::No);
+    States.RemoveAtSwap(index, 1, EAllowShrinking::No);
+    Flags.RemoveAtSwap(index, 1, EAllowShrinking::No);
+    EasingKernels.RemoveAtSwap(index, 1, EAllowShrinking::No);
+    EasingTables.RemoveAtSwap(index, 1, EAllowShrinking::No);
+    ElapsedTimes.RemoveAtSwap(index, 1, EAllowShrinking::No);
+    Durations.RemoveAtSwap(index, 1, EAllowShrinking::No);
+    ThreadingTypes.RemoveAtSwap(index, 1, EAllowShrinking::No);
+    StartVectors.RemoveAtSwap(index, 1, EAllowShrinking::No);
+    EndVectors.RemoveAtSwap(index, 1, EAllowShrinking::No);
+    StartQuats.RemoveAtSwap(index, 1, EAllowShrinking::No);
+    EndQuats.RemoveAtSwap(index, 1, EAllowShrinking::No);
+    AppliedVectors.RemoveAtSwap(index, 1, EAllowShrinking::No);
+    AppliedQuats.RemoveAtSwap(index, 1, EAllowShrinking::No);
+    FinishedDelegates.RemoveAtSwap(index, 1, EAllowShrinking::No);
+
+    // The tween swapped into this position keeps its handle, only its dense index moved
+    if (SlotIndices.IsValidIndex(index))
+    {
+        Slots[SlotIndices[index]].DenseIndex = index;
+    }
+}
+
+int32 UAdvTweenSubsystem::AcquireWriteRecord(UObject* target)
+{
+    if (const int32* ExistingIndex = WriteRecordLookup.Find(target))
+    {
+        ++WriteRecords[*ExistingIndex].RefCount;
+        return *ExistingIndex;
+    }
+
+    const int32 RecordIndex = FreeWriteRecords.Num() > 0 ? FreeWriteRecords.Pop(EAllowShrinking::No) : WriteRecords.AddDefaulted();
+    FTweenWriteRecord& Record = WriteRecords[RecordIndex];
+    Record.Actor = Cast<AActor>(target);
+    Record.Component = Cast<USceneComponent>(target);
+    Record.TargetKey = target;
+    Record.RefCount = 1;
+
+    WriteRecordLookup.Add(target, RecordIndex);
+    return RecordIndex;
+}
+
+void UAdvTweenSubsystem::ReleaseWriteRecord(int32 recordIndex)
+{
+    FTweenWriteRecord& Record = WriteRecords[recordIndex];
+    if (--Record.RefCount > 0)
+    {
+        return;
+    }
+
+    WriteRecordLookup.Remove(Record.TargetKey);
+    Record = FTweenWriteRecord();
+    FreeWriteRecords.Add(recordIndex);
+}
+
+void UAdvTweenSubsystem::FlushWriteRecord(FTweenWriteRecord& record)
+{
+    AActor* TargetActor = record.Actor.Get();
+    USceneComponent* TargetComponent = record.Component.Get();
+    if (IsValid(TargetActor) || IsValid(TargetComponent))
+    {
+        // Components are written relative to their parent, which skips the world-to-relative conversion
+        FTransform NewTransform = TargetComponent ? TargetComponent->GetRelativeTransform() : TargetActor->GetActorTransform();
+
+        // Additive changes always accumulate so they survive an owner being paused
+        const uint8 WrittenMask = record.AbsoluteMask | record.AdditiveMask;
+        const uint8 LocationBit = ChannelBit(ETweenChannel::Location);
+        if (WrittenMask & LocationBit)
+        {
+            record.AccumulatedLocation += record.LocationIncrement;
+            NewTransform.SetLocation((record.AbsoluteMask & LocationBit)
+                ? record.Location + record.AccumulatedLocation
+                : NewTransform.GetLocation() + record.LocationIncrement);
+        }
+
+        const uint8 RotationBit = ChannelBit(ETweenChannel::Rotation);
+        if (WrittenMask & RotationBit)
+        {
+            record.AccumulatedRotation = record.RotationIncrement * record.AccumulatedRotation;
+            NewTransform.SetRotation((record.AbsoluteMask & RotationBit)
+                ? record.AccumulatedRotation * record.Rotation
+                : record.RotationIncrement * NewTransform.GetRotation());
+        }
+
+        const uint8 ScaleBit = ChannelBit(ETweenChannel::Scale);
+        if (WrittenMask & ScaleBit)
+        {
+            record.AccumulatedScale += record.ScaleIncrement;
+            NewTransform.SetScale3D((record.AbsoluteMask & ScaleBit)
+                ? record.Scale + record.AccumulatedScale
+                : NewTransform.GetScale3D() + record.ScaleIncrement);
+        }
+
+        // One update for every channel driven on this actor or component, through the cheapest setter that covers them
+        if (TargetComponent)
+        {
+            // SetRelativeTransform reports nothing, so apply the actor setters' rule: a sweep only fails if it could not move at all
+            FHitResult SweepHit;
+            TargetComponent->SetRelativeTransform(NewTransform, record.bSweep, record.bSweep ? &SweepHit : nullptr);
+            record.bWriteSucceeded = !SweepHit.bBlockingHit || SweepHit.Time > 0.0f;
+        }
+        else if ((WrittenMask & LocationBit) || record.bSweep)
+        {
+            // The setter's own result, as the baseline move reported it: a sweep that ends touching something still moved
+            record.bWriteSucceeded = TargetActor->SetActorTransform(NewTransform, record.bSweep);
+        }
+        else if (WrittenMask == RotationBit)
+        {
+            record.bWriteSucceeded = TargetActor->SetActorRotation(NewTransform.GetRotation());
+        }
+        else if (WrittenMask == ScaleBit)
+        {
+            TargetActor->SetActorScale3D(NewTransform.GetScale3D());
+            record.bWriteSucceeded = TargetActor->GetRootComponent() != nullptr;
+        }
+        else
+        {
+            // Rotation and scale together still take a single update
+            record.bWriteSucceeded = TargetActor->SetActorTransform(NewTransform);
+        }
+
+        INC_DWORD_STAT(STAT_AdvTween_Writes);
+        if (record.bSweep)
+        {
+            INC_DWORD_STAT(STAT_AdvTween_SweptWrites);
+            CSV_CUSTOM_STAT(AdvBPTools, SweptWrites, 1, ECsvCustomStatOp::Accumulate);
+        }
+    }
+    else
+    {
+        record.bWriteSucceeded = false;
+    }
+
+    record.LocationIncrement = FVector::ZeroVector;
+    record.RotationIncrement = FQuat::Identity;
+    record.ScaleIncrement = FVector::ZeroVector;
+    record.AbsoluteMask = 0;
+    record.AdditiveMask = 0;
+    record.bSweep = false;
+    record.bDeferMovement = false;
+    record.bDirty = false;
+}
+
+USceneComponent* UAdvTweenSubsystem::GetDeferredMovementComponent(const FTweenWriteRecord& record) const
+{
+    // Sweeps report hits and overlaps immediately unless swept writes may be deferred too
+    if (!record.bDeferMovement || (record.bSweep && !GTweenDeferSweptMovement))
+    {
+        return nullptr;
+    }
+
+    if (USceneComponent* TargetComponent = record.Component.Get())
+    {
+        return TargetComponent;
+    }
+
+    const AActor* TargetActor = record.Actor.Get();
+    return TargetActor ? TargetActor->GetRootComponent() : nullptr;
+}
+
+int32 UAdvTweenSubsystem::AcquireInstanceBatch(UInstancedStaticMeshComponent* component)
+{
+    if (const int32* ExistingIndex = InstanceBatchLookup.Find(component))
+    {
+        ++InstanceBatches[*ExistingIndex].RefCount;
+        return *ExistingIndex;
+    }
+
+    const int32 BatchIndex = FreeInstanceBatches.Num() > 0 ? FreeInstanceBatches.Pop(EAllowShrinking::No) : InstanceBatches.AddDefaulted();
+    FTweenInstanceBatch& Batch = InstanceBatches[BatchIndex];
+    Batch.Component = component;
+    Batch.ComponentKey = component;
+    Batch.RefCount = 1;
+
+    InstanceBatchLookup.Add(component, BatchIndex);
+    return BatchIndex;
+}
+
+void UAdvTweenSubsystem::ReleaseInstanceBatch(int32 batchIndex)
+{
+    FTweenInstanceBatch& Batch = InstanceBatches[batchIndex];
+    if (--Batch.RefCount > 0)
+    {
+        return;
+    }
+
+    InstanceBatchLookup.Remove(Batch.ComponentKey);
+    Batch = FTweenInstanceBatch();
+    FreeInstanceBatches.Add(batchIndex);
+}
+
+bool UAdvTweenSubsystem::ApplyInstanceResult(int32 index)
+{
+    const int32 BatchIndex = WriteRecordIndices[index];
+    const int32 InstanceIndex = InstanceIndices[index];
+    FTweenInstanceBatch& Batch = InstanceBatches[BatchIndex];
+
+    // The first write to an instance this frame starts from its current transform, keeping untweened channels
+    const int32* ExistingIndex = Batch.PendingLookup.Find(InstanceIndex);
+    int32 PendingIndex = ExistingIndex ? *ExistingIndex : INDEX_NONE;
+    if (PendingIndex == INDEX_NONE)
+    {
+        FTransform CurrentTransform;
+        if (!GetTargetTransform(index, CurrentTransform))
+        {
+            return false;
+        }
+
+        PendingIndex = Batch.PendingWrites.Emplace(InstanceIndex, CurrentTransform);
+        Batch.PendingLookup.Add(InstanceIndex, PendingIndex);
+    }
+
+    if (!Batch.bDirty)
+    {
+        Batch.bDirty = true;
+        DirtyInstanceBatches.Add(BatchIndex);
+    }
+
+    FTransform& PendingTransform = Batch.PendingWrites[PendingIndex].Value;
+    switch (Channels[index])
+    {
+    case ETweenChannel::Location:
+        PendingTransform.SetLocation(ResultVectors[index]);
+        break;
+
+    case ETweenChannel::Rotation:
+        PendingTransform.SetRotation(ResultQuats[index]);
+        break;
+
+    case ETweenChannel::Scale:
+        PendingTransform.SetScale3D(ResultVectors[index]);
+        break;
+    }
+
+    return true;
+}
+
+void UAdvTweenSubsystem::FlushInstanceBatch(FTweenInstanceBatch& batch)
+{
+    UInstancedStaticMeshComponent* Component = batch.Component.Get();
+    if (IsValid(Component))
+    {
+        // Neighbouring instances go out together as one contiguous batch update, an isolated index is a run of one
+        batch.PendingWrites.Sort([](const TPair<int32, FTransform>& a, const TPair<int32, FTransform>& b)
+        {
+            return a.Key < b.Key;
+        });
+
+        bool bSuccess = true;
+        int32 RunStart = 0;
+        while (RunStart < batch.PendingWrites.Num())
+        {
+            int32 RunEnd = RunStart + 1;
+            while (RunEnd < batch.PendingWrites.Num() && batch.PendingWrites[RunEnd].Key == batch.PendingWrites[RunEnd - 1].Key + 1)
+            {
+                ++RunEnd;
+            }
+
+            InstanceRunTransforms.Reset();
+            for (int32 WriteIndex = RunStart; WriteIndex < RunEnd; ++WriteIndex)
+            {
+                InstanceRunTransforms.Add(batch.PendingWrites[WriteIndex].Value);
+            }
+
+            // Render state is left alone here and dirtied once below
+            bSuccess &= Component->BatchUpdateInstancesTransforms(batch.PendingWrites[RunStart].Key, InstanceRunTransforms, true, false, false);
+            RunStart = RunEnd;
+        }
+
+        // Render data is rebuilt once for every instance touched this frame
+        Component->MarkRenderStateDirty();
+        batch.bWriteSucceeded = bSuccess;
+    }
+    else
+    {
+        batch.bWriteSucceeded = false;
+    }
+
+    batch.PendingWrites.Reset();
+    batch.PendingLookup.Reset();
+    batch.bDirty = false;
+}
+
+bool UAdvTweenSubsystem::GetParameterValue(int32 index, FLinearColor& outValue) const
+{
+    UObject* Target = Targets[index].Get();
+    if (!IsValid(Target))
+    {
+        return false;
+    }
+
+    const FTweenParameter& Parameter = Parameters[ParameterIndices[index]];
+    if (Parameter.ParameterName.IsNone())
+    {
+        // Floats never set read as zero in the material as well
+        const TArray<float>& Data = CastChecked<UPrimitiveComponent>(Target)->GetCustomPrimitiveData().Data;
+        for (int32 ValueIndex = 0; ValueIndex < Parameter.NumValues; ++ValueIndex)
+        {
+            const int32 DataIndex = Parameter.DataIndex + ValueIndex;
+            outValue.Component(ValueIndex) = Data.IsValidIndex(DataIndex) ? Data[DataIndex] : 0.0f;
+        }
+        return true;
+    }
+
+    const UMaterialParameterCollectionInstance* Instance = GetWorld()->GetParameterCollectionInstance(CastChecked<UMaterialParameterCollection>(Target));
+    if (!Instance)
+    {
+        return false;
+    }
+
+    return Parameter.NumValues == 1
+        ? Instance->GetScalarParameterValue(Parameter.ParameterName, outValue.R)
+        : Instance->GetVectorParameterValue(Parameter.ParameterName, outValue);
+}
+
+int32 UAdvTweenSubsystem::AcquireParameterBatch(UObject* target)
+{
+    if (const int32* ExistingIndex = ParameterBatchLookup.Find(target))
+    {
+        ++ParameterBatches[*ExistingIndex].RefCount;
+        return *ExistingIndex;
+    }
+
+    const int32 BatchIndex = FreeParameterBatches.Num() > 0 ? FreeParameterBatches.Pop(EAllowShrinking::No) : ParameterBatches.AddDefaulted();
+    FTweenParameterBatch& Batch = ParameterBatches[BatchIndex];
+    Batch.Target = target;
+    Batch.TargetKey = target;
+    Batch.RefCount = 1;
+
+    ParameterBatchLookup.Add(target, BatchIndex);
+    return BatchIndex;
+}
+
+void UAdvTweenSubsystem::ReleaseParameterBatch(int32 batchIndex)
+{
+    FTweenParameterBatch& Batch = ParameterBatches[batchIndex];
+    if (--Batch.RefCount > 0)
+    {
+        return;
+    }
+
+    ParameterBatchLookup.Remove(Batch.TargetKey);
+    Batch = FTweenParameterBatch();
+    FreeParameterBatches.Add(batchIndex);
+}
+
+void UAdvTweenSubsystem::ApplyParameterResult(int32 index)
+{
+    const int32 BatchIndex = WriteRecordIndices[index];
+    FTweenParameterBatch& Batch = ParameterBatches[BatchIndex];
+    const FTweenParameter& Parameter = Parameters[ParameterIndices[index]];
+    const bool bPrimitiveData = Parameter.ParameterName.IsNone();
+
+    // The first write to a component this frame starts from its current data, keeping floats no tween drives
+    if (!Batch.bDirty)
+    {
+        Batch.bDirty = true;
+        DirtyParameterBatches.Add(BatchIndex);
+
+        if (bPrimitiveData)
+        {
+            Batch.PendingData = CastChecked<UPrimitiveComponent>(Targets[index].Get())->GetCustomPrimitiveData().Data;
+            Batch.DirtyBegin = FCustomPrimitiveData::NumCustomPrimitiveDataFloats;
+            Batch.DirtyEnd = 0;
+        }
+    }
+
+    if (bPrimitiveData)
+    {
+        const int32 DataEnd = Parameter.DataIndex + Parameter.NumValues;
+        if (Batch.PendingData.Num() < DataEnd)
+        {
+            Batch.PendingData.SetNumZeroed(DataEnd);
+        }
+
+        for (int32 ValueIndex = 0; ValueIndex < Parameter.NumValues; ++ValueIndex)
+        {
+            Batch.PendingData[Parameter.DataIndex + ValueIndex] = Parameter.Value.Component(ValueIndex);
+        }
+        Batch.DirtyBegin = FMath::Min(Batch.DirtyBegin, Parameter.DataIndex);
+        Batch.DirtyEnd = FMath::Max(Batch.DirtyEnd, DataEnd);
+    }
+    else if (Parameter.NumValues == 1)
+    {
+        Batch.PendingScalars.Emplace(Parameter.ParameterName, Parameter.Value.R);
+    }
+    else
+    {
+        Batch.PendingVectors.Emplace(Parameter.ParameterName, Parameter.Value);
+    }
+}
+
+void UAdvTweenSubsystem::FlushParameterBatch(FTweenParameterBatch& batch)
+{
+    UObject* Target = batch.Target.Get();
+    UPrimitiveComponent* Component = Cast<UPrimitiveComponent>(Target);
+    UMaterialParameterCollection* Collection = Cast<UMaterialParameterCollection>(Target);
+
+    if (IsValid(Component))
+    {
+        // The touched range goes out four floats at a time, each call is one primitive data update on the render thread
+        for (int32 DataIndex = batch.DirtyBegin; DataIndex < batch.DirtyEnd; DataIndex += 4)
+        {
+            const float* Values = &batch.PendingData[DataIndex];
+            switch (FMath::Min(4, batch.DirtyEnd - DataIndex))
+            {
+            case 1:
+                Component->SetCustomPrimitiveDataFloat(DataIndex, Values[0]);
+                break;
+
+            case 2:
+                Component->SetCustomPrimitiveDataVector2(DataIndex, FVector2D(Values[0], Values[1]));
+                break;
+
+            case 3:
+                Component->SetCustomPrimitiveDataVector3(DataIndex, FVector(Values[0], Values[1], Values[2]));
+                break;
+
+            default:
+                Component->SetCustomPrimitiveDataVector4(DataIndex, FVector4(Values[0], Values[1], Values[2], Values[3]));
+                break;
+            }
+        }
+        batch.bWriteSucceeded = true;
+    }
+    else if (IsValid(Collection))
+    {
+        // The collection's uniform buffer is rebuilt once at the end of the frame, however many parameters change
+        UMaterialParameterCollectionInstance* Instance = GetWorld()->GetParameterCollectionInstance(Collection);
+        bool bSuccess = Instance != nullptr;
+        if (Instance)
+        {
+            for (const TPair<FName, float>& Scalar : batch.PendingScalars)
+            {
+                bSuccess &= Instance->SetScalarParameterValue(Scalar.Key, Scalar.Value);
+            }
+
+            for (const TPair<FName, FLinearColor>& Vector : batch.PendingVectors)
+            {
+                bSuccess &= Instance->SetVectorParameterValue(Vector.Key, Vector.Value);
+            }
+        }
+        batch.bWriteSucceeded = bSuccess;
+    }
+    else
+    {
+        batch.bWriteSucceeded = false;
+    }
+
+    batch.PendingData.Reset();
+    batch.PendingScalars.Reset();
+    batch.PendingVectors.Reset();
+    batch.bDirty = false;
+}
+
+int32 UAdvTweenSubsystem::AllocateParameter()
+{
+    const int32 ParameterIndex = FreeParameters.Num() > 0 ? FreeParameters.Pop(EAllowShrinking::No) : Parameters.AddDefaulted();
+    Parameters[ParameterIndex] = FTweenParameter();
+    return ParameterIndex;
+}
+
+int32 UAdvTweenSubsystem::AllocateTrack()
+{
+    if (FreeTracks.Num() == 0)
+    {
+        return Tracks.AddDefaulted();
+    }
+
+    // Keep the key arrays' capacity for the next track
+    const int32 TrackIndex = FreeTracks.Pop(EAllowShrinking::No);
+    FTweenTrack& Track = Tracks[TrackIndex];
+    Track.Times.Reset();
+    Track.Locations.Reset();
+    Track.Rotations.Reset();
+    Track.Scales.Reset();
+    Track.Kernels.Reset();
+    Track.Cursor = 0;
+    Track.ChannelMask = 0;
+    return TrackIndex;
+}
+
+void UAdvTweenSubsystem::FTweenTrack::Begin(const FTransform& currentTransform)
+{
+    if (Times[0] > 0.0f)
+    {
+        Times.Insert(0.0f, 0);
+        Locations.Insert(currentTransform.GetLocation(), 0);
+        Rotations.Insert(currentTransform.GetRotation(), 0);
+        Scales.Insert(currentTransform.GetScale3D(), 0);
+        Kernels.Insert(UAdvBPUtilities::ResolveEasingKernel(EEasingFunction::Linear), 0);
+    }
+
+    // Neighbouring keys on the same hemisphere so every segment rotates the short way
+    for (int32 KeyIndex = 1; KeyIndex < Rotations.Num(); ++KeyIndex)
+    {
+        if ((Rotations[KeyIndex - 1] | Rotations[KeyIndex]) < 0.0f)
+        {
+            Rotations[KeyIndex] = -Rotations[KeyIndex];
+        }
+    }
+
+    Cursor = 0;
+    Evaluate(0.0f);
+}
+
+void UAdvTweenSubsystem::FTweenTrack::Evaluate(float time)
+{
+    if (Times.Num() == 1)
+    {
+        Location = Locations[0];
+        Rotation = Rotations[0];
+        Scale = Scales[0];
+        return;
+    }
+
+    // Playback moves forward, so the cursor advances by at most a key or two per update; seeking back rewinds it
+    if (time < Times[Cursor])
+    {
+        Cursor = 0;
+    }
+    while (Cursor < Times.Num() - 2 && time >= Times[Cursor + 1])
+    {
+        ++Cursor;
+    }
+
+    const int32 NextKey = Cursor + 1;
+    const float SegmentLength = Times[NextKey] - Times[Cursor];
+    const float Alpha = SegmentLength > KINDA_SMALL_NUMBER ? FMath::Clamp((time - Times[Cursor]) / SegmentLength, 0.0f, 1.0f) : 1.0f;
+    const float EasedAlpha = Kernels[NextKey](Alpha);
+
+    Location = FMath::Lerp(Locations[Cursor], Locations[NextKey], EasedAlpha);
+    Rotation = FQuat::Slerp(Rotations[Cursor], Rotations[NextKey], EasedAlpha);
+    Scale = FMath::Lerp(Scales[Cursor], Scales[NextKey], EasedAlpha);
+}
+
+int32 UAdvTweenSubsystem::AcquireSplinePath(USplineComponent* spline)
+{
+    if (const int32* ExistingIndex = SplinePathLookup.Find(spline))
+    {
+        ++SplinePaths[*ExistingIndex].RefCount;
+        return *ExistingIndex;
+    }
+
+    const int32 PathIndex = FreeSplinePaths.Num() > 0 ? FreeSplinePaths.Pop(EAllowShrinking::No) : SplinePaths.AddDefaulted();
+    FTweenSplinePath& Path = SplinePaths[PathIndex];
+    Path.Spline = spline;
+    Path.SplineKey = spline;
+    Path.RefCount = 1;
+    Path.Build(*spline);
+
+    SplinePathLookup.Add(spline, PathIndex);
+    return PathIndex;
+}
+
+void UAdvTweenSubsystem::ReleaseSplinePath(int32 pathIndex)
+{
+    FTweenSplinePath& Path = SplinePaths[pathIndex];
+    if (--Path.RefCount > 0)
+    {
+        return;
+    }
+
+    SplinePathLookup.Remove(Path.SplineKey);
+    Path = FTweenSplinePath();
+    FreeSplinePaths.Add(pathIndex);
+}
+
+void UAdvTweenSubsystem::UpdateSplinePaths()
+{
+    for (FTweenSplinePath& Path : SplinePaths)
+    {
+        if (Path.RefCount == 0)
+        {
+            continue;
+        }
+
+        const USplineComponent* Spline = Path.Spline.Get();
+        Path.bValid = IsValid(Spline);
+        if (!Path.bValid)
+        {
+            continue;
+        }
+
+        // Edited splines are resampled, moved ones only need the new transform
+        if (Spline->SplineCurves.Version != Path.Version)
+        {
+            Path.Build(*Spline);
+        }
+        Path.ComponentTransform = Spline->GetComponentTransform();
+    }
+}
+
+void UAdvTweenSubsystem::FTweenSplinePath::Build(const USplineComponent& spline)
+{
+    Version = spline.SplineCurves.Version;
+    Length = spline.GetSplineLength();
+    ComponentTransform = spline.GetComponentTransform();
+    bValid = true;
+
+    const float SampleSpacing = FMath::Max(1.0f, GTweenSplineSampleSpacing);
+    const int32 NumSamples = FMath::Clamp(FMath::CeilToInt32(Length / SampleSpacing) + 1, MinSplineSamples, MaxSplineSamples);
+
+    // The one expensive pass, distance queries walk the spline's reparameterization table
+    Locations.SetNumUninitialized(NumSamples);
+    Rotations.SetNumUninitialized(NumSamples);
+    for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+    {
+        const float Distance = Length * SampleIndex / (NumSamples - 1);
+        Locations[SampleIndex] = spline.GetLocationAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::Local);
+        Rotations[SampleIndex] = spline.GetQuaternionAtDistanceAlongSpline(Distance, ESplineCoordinateSpace::Local);
+    }
+}
+
+void UAdvTweenSubsystem::FTweenSplinePath::Sample(float distance, FVector& outLocation, FQuat& outRotation) const
+{
+    const float SamplePosition = Length > 0.0f ? FMath::Clamp(distance / Length, 0.0f, 1.0f) * (Locations.Num() - 1) : 0.0f;
+    const int32 SampleIndex = FMath::Min(FMath::FloorToInt32(SamplePosition), Locations.Num() - 2);
+    const float SampleAlpha = SamplePosition - SampleIndex;
+
+    // Neighbouring samples are close, a normalized lerp is as good as a slerp here
+    const FVector LocalLocation = FMath::Lerp(Locations[SampleIndex], Locations[SampleIndex + 1], SampleAlpha);
+    const FQuat LocalRotation = FQuat::FastLerp(Rotations[SampleIndex], Rotations[SampleIndex + 1], SampleAlpha).GetNormalized();
+
+    outLocation = ComponentTransform.TransformPosition(LocalLocation);
+    outRotation = ComponentTransform.TransformRotation(LocalRotation);
+}
+
+void UAdvTweenSubsystem::Initialize(FSubsystemCollectionBase& collection)
+{
+    Super::Initialize(collection);
+
+    // Preallocate the arena so starting tweens does not touch the heap
+    const int32 Capacity = FMath::Max(0, GTweenInitialCapacity);
+    Slots.Reserve(Capacity);
+    FreeSlots.Reserve(Capacity);
+    WriteRecords.Reserve(Capacity);
+    FreeWriteRecords.Reserve(Capacity);
+    WriteRecordLookup.Reserve(Capacity);
+    SlotIndices.Reserve(Capacity);
+    Targets.Reserve(Capacity);
+    WriteRecordIndices.Reserve(Capacity);
+    InstanceIndices.Reserve(Capacity);
+    SplinePathIndices.Reserve(Capacity);
+    TrackIndices.Reserve(Capacity);
+    SequenceIndices.Reserve(Capacity);
+    RetargetIndices.Reserve(Capacity);
+    ParameterIndices.Reserve(Capacity);
+    PropertyIndices.Reserve(Capacity);
+    Channels.Reserve(Capacity);
+    States.Reserve(Capacity);
+    Flags.Reserve(Capacity);
+    EasingKernels.Reserve(Capacity);
+    EasingTables.Reserve(Capacity);
+    ElapsedTimes.Reserve(Capacity);
+    Durations.Reserve(Capacity);
+    ThreadingTypes.Reserve(Capacity);
+    StartVectors.Reserve(Capacity);
+    EndVectors.Reserve(Capacity);
+    StartQuats.Reserve(Capacity);
+    EndQuats.Reserve(Capacity);
+    AppliedVectors.Reserve(Capacity);
+    AppliedQuats.Reserve(Capacity);
+    FinishedDelegates.Reserve(Capacity);
+    ResultVectors.Reserve(Capacity);
+    ResultQuats.Reserve(Capacity);
+    GameThreadIndices.Reserve(Capacity);
+    HighPrioIndices.Reserve(Capacity);
+    NormalPrioIndices.Reserve(Capacity);
+    DirtyWriteRecords.Reserve(Capacity);
+}
+
+void UAdvTweenSubsystem::Deinitialize()
+{
+    // Tweens still running when the world goes away never complete
+    Slots.Empty();
+    FreeSlots.Empty();
+    WriteRecords.Empty();
+    FreeWriteRecords.Empty();
+    WriteRecordLookup.Empty();
+    InstanceBatches.Empty();
+    FreeInstanceBatches.Empty();
+    InstanceBatchLookup.Empty();
+    SlotIndices.Empty();
+    Targets.Empty();
+    WriteRecordIndices.Empty();
+    InstanceIndices.Empty();
+    SplinePathIndices.Empty();
+    TrackIndices.Empty();
+    SequenceIndices.Empty();
+    RetargetIndices.Empty();
+    ParameterIndices.Empty();
+    PropertyIndices.Empty();
+    ParameterBatches.Empty();
+    FreeParameterBatches.Empty();
+    ParameterBatchLookup.Empty();
+    Parameters.Empty();
+    FreeParameters.Empty();
+    Properties.Empty();
+    FreeProperties.Empty();
+    PropertyOwners.Empty();
+    Retargets.Empty();
+    FreeRetargets.Empty();
+    NumFollowing = 0;
+    Tracks.Empty();
+    FreeTracks.Empty();
+    Sequences.Empty();
+    FreeSequences.Empty();
+    NumActiveSequences = 0;
+    SplinePaths.Empty();
+    FreeSplinePaths.Empty();
+    SplinePathLookup.Empty();
+    Channels.Empty();
+    States.Empty();
+    Flags.Empty();
+    EasingKernels.Empty();
+    EasingTables.Empty();
+    ElapsedTimes.Empty();
+    Durations.Empty();
+    ThreadingTypes.Empty();
+    StartVectors.Empty();
+    EndVectors.Empty();
+    StartQuats.Empty();
+    EndQuats.Empty();
+    AppliedVectors.Empty();
+    AppliedQuats.Empty();
+    FinishedDelegates.Empty();
+    PendingPromotions.Empty();
+
+    Super::Deinitialize();
+}
+
+bool UAdvTweenSubsystem::IsTickable() const
+{
+    return Targets.Num() > 0 || NumActiveSequences > 0;
+}
+
+TStatId UAdvTweenSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UAdvTweenSubsystem, STATGROUP_AdvBPTools);
+}
+
+void UAdvTweenSubsystem::ComputeTweens(TConstArrayView<int32> indices)
+{
+    for (const int32 Index : indices)
+    {
+        // Curve was resolved when the tween started, alpha is already within 0.0-1.0
+        const float Alpha = FMath::Min(ElapsedTimes[Index] / Durations[Index], 1.0f);
+        const FAdvEasingTable* EasingTable = EasingTables[Index].Get();
+        const float EasedAlpha = EasingTable ? EasingTable->Evaluate(Alpha) : EasingKernels[Index](Alpha);
+
+        // Material parameters evaluate into their parameter entry
+        if (ParameterIndices[Index] != INDEX_NONE)
+        {
+            FTweenParameter& Parameter = Parameters[ParameterIndices[Index]];
+            Parameter.Value = FMath::Lerp(Parameter.StartValue, Parameter.EndValue, EasedAlpha);
+            continue;
+        }
+
+        // Properties evaluate their packed value, rotators take the shortest way round
+        if (PropertyIndices[Index] != INDEX_NONE)
+        {
+            FTweenProperty& Property = Properties[PropertyIndices[Index]];
+            if (Property.Type == ETweenPropertyType::Rotator)
+            {
+                using FRotatorTraits = TAdvTweenPropertyTraits<FRotator>;
+                Property.Value = FRotatorTraits::Pack(UAdvBPUtilities::LerpEasedValue(
+                    FRotatorTraits::Unpack(Property.StartValue), FRotatorTraits::Unpack(Property.EndValue), EasedAlpha));
+            }
+            else
+            {
+                for (int32 ValueIndex = 0; ValueIndex < 4; ++ValueIndex)
+                {
+                    Property.Value[ValueIndex] = UAdvBPUtilities::LerpEasedValue(Property.StartValue[ValueIndex], Property.EndValue[ValueIndex], EasedAlpha);
+                }
+            }
+            continue;
+        }
+
+        // Tracks carry their own per-segment curves and write their own output
+        if (TrackIndices[Index] != INDEX_NONE)
+        {
+            Tracks[TrackIndices[Index]].Evaluate(FMath::Min(ElapsedTimes[Index], Durations[Index]));
+            continue;
+        }
+
+        // Easing applies to the distance travelled, the table turns it into a point on the spline
+        if (SplinePathIndices[Index] != INDEX_NONE)
+        {
+            const float Distance = FMath::Lerp(StartVectors[Index].X, EndVectors[Index].X, EasedAlpha);
+            SplinePaths[SplinePathIndices[Index]].Sample(Distance, ResultVectors[Index], ResultQuats[Index]);
+
+            // Travelling backwards faces against the spline's direction
+            if (StartVectors[Index].X > EndVectors[Index].X)
+            {
+                ResultQuats[Index] = ResultQuats[Index] * FQuat(FVector::UpVector, PI);
+            }
+            continue;
+        }
+
+        if (Channels[Index] == ETweenChannel::Rotation)
+        {
+            ResultQuats[Index] = FQuat::Slerp(StartQuats[Index], EndQuats[Index], EasedAlpha);
+        }
+        else
+        {
+            ResultVectors[Index] = FMath::Lerp(StartVectors[Index], EndVectors[Index], EasedAlpha);
+        }
+
+        // Retargeted tweens keep their original curve and blend the target change on top
+        if (RetargetIndices[Index] != INDEX_NONE)
+        {
+            FVector Offset;
+            FVector OffsetVelocity;
+            Retargets[RetargetIndices[Index]].Evaluate(FMath::Min(ElapsedTimes[Index], Durations[Index]), Durations[Index], Offset, OffsetVelocity);
+
+            if (Channels[Index] == ETweenChannel::Rotation)
+            {
+                ResultQuats[Index] = FQuat::MakeFromRotationVector(Offset) * ResultQuats[Index];
+            }
+            else
+            {
+                ResultVectors[Index] += Offset;
+            }
+        }
+    }
+}
+
+void UAdvTweenSubsystem::CountFinishedTween(bool bSuccess)
+{
+    if (bSuccess)
+    {
+        INC_DWORD_STAT(STAT_AdvTween_Completions);
+        CSV_CUSTOM_STAT(AdvBPTools, Completions, 1, ECsvCustomStatOp::Accumulate);
+    }
+    else
+    {
+        INC_DWORD_STAT(STAT_AdvTween_Failures);
+        CSV_CUSTOM_STAT(AdvBPTools, Failures, 1, ECsvCustomStatOp::Accumulate);
+    }
+}
+
+#if STATS
+void UAdvTweenSubsystem::UpdateTweenCountStats() const
+{
+    // Only paid for while stats are compiled in; counters reset every frame, so set the whole breakdown
+    uint32 NumByChannel[3] = { 0, 0, 0 };
+    uint32 NumInstance = 0;
+    uint32 NumSpline = 0;
+    uint32 NumTrack = 0;
+    uint32 NumParameter = 0;
+    uint32 NumProperty = 0;
+    uint32 NumWaiting = 0;
+
+    for (int32 Index = 0; Index < Targets.Num(); ++Index)
+    {
+        if (States[Index] == ETweenState::Paused || States[Index] == ETweenState::Queued)
+        {
+            ++NumWaiting;
+        }
+
+        if (InstanceIndices[Index] != INDEX_NONE)
+        {
+            ++NumInstance;
+        }
+        else if (ParameterIndices[Index] != INDEX_NONE)
+        {
+            ++NumParameter;
+        }
+        else if (PropertyIndices[Index] != INDEX_NONE)
+        {
+            ++NumProperty;
+        }
+        else if (SplinePathIndices[Index] != INDEX_NONE)
+        {
+            ++NumSpline;
+        }
+        else if (TrackIndices[Index] != INDEX_NONE)
+        {
+            ++NumTrack;
+        }
+        else
+        {
+            ++NumByChannel[static_cast<int32>(Channels[Index])];
+        }
+    }
+
+    SET_DWORD_STAT(STAT_AdvTween_NumLocation, NumByChannel[static_cast<int32>(ETweenChannel::Location)]);
+    SET_DWORD_STAT(STAT_AdvTween_NumRotation, NumByChannel[static_cast<int32>(ETweenChannel::Rotation)]);
+    SET_DWORD_STAT(STAT_AdvTween_NumScale, NumByChannel[static_cast<int32>(ETweenChannel::Scale)]);
+    SET_DWORD_STAT(STAT_AdvTween_NumInstance, NumInstance);
+    SET_DWORD_STAT(STAT_AdvTween_NumSpline, NumSpline);
+    SET_DWORD_STAT(STAT_AdvTween_NumTrack, NumTrack);
+    SET_DWORD_STAT(STAT_AdvTween_NumParameter, NumParameter);
+    SET_DWORD_STAT(STAT_AdvTween_NumProperty, NumProperty);
+    SET_DWORD_STAT(STAT_AdvTween_NumWaiting, NumWaiting);
+    SET_DWORD_STAT(STAT_AdvTween_NumSequences, NumActiveSequences);
+}
+#endif
+
+void UAdvTweenSubsystem::LaunchComputeTasks(TConstArrayView<int32> indices, UE::Tasks::ETaskPriority priority)
+{
+    for (int32 BatchStart = 0; BatchStart < indices.Num(); BatchStart += ComputeBatchSize)
+    {
+        const TConstArrayView<int32> Batch = indices.Slice(BatchStart, FMath::Min(ComputeBatchSize, indices.Num() - BatchStart));
+
+        ComputeTasks.Add(UE::Tasks::Launch(
+            UE_SOURCE_LOCATION,
+            [this, Batch]()
+            {
+                TRACE_CPUPROFILER_EVENT_SCOPE(AdvTween_ComputeBatch);
+                ComputeTweens(Batch);
+            },
+            priority));
+    }
+}
+
+void UAdvTweenSubsystem::Tick(float deltaTime)
+{
+    Super::Tick(deltaTime);
+
+    // Fixed step keeps elapsed times on a deterministic grid; catch-up steps collapse into one evaluation
+    float UpdateTime = deltaTime;
+    if (GTweenUpdateMode == static_cast<int32>(ETweenUpdateMode::FixedStep))
+    {
+        const float StepTime = 1.0f / FMath::Max(1.0f, GTweenFixedStepRate);
+        FixedStepAccumulator += deltaTime;
+
+        const int32 NumSteps = FMath::FloorToInt32(FixedStepAccumulator / StepTime);
+        if (NumSteps == 0)
+        {
+            // Counters reset every frame, so frames between steps still report what is active
+#if STATS
+            UpdateTweenCountStats();
+#endif
+            CSV_CUSTOM_STAT(AdvBPTools, ActiveTweens, Targets.Num(), ECsvCustomStatOp::Set);
+            CSV_CUSTOM_STAT(AdvBPTools, EvaluatedTweens, 0, ECsvCustomStatOp::Set);
+            return;
+        }
+
+        UpdateTime = NumSteps * StepTime;
+        FixedStepAccumulator -= UpdateTime;
+    }
+
+    SCOPE_CYCLE_COUNTER(STAT_AdvTween_Update);
+    TRACE_CPUPROFILER_EVENT_SCOPE(AdvTween_Update);
+    CSV_SCOPED_TIMING_STAT(AdvBPTools, TweenUpdate);
+
+    const int32 Count = Targets.Num();
+    ResultVectors.SetNumUninitialized(Count, EAllowShrinking::No);
+    ResultQuats.SetNumUninitialized(Count, EAllowShrinking::No);
+
+    bIsUpdating = true;
+
+    UpdateSplinePaths();
+
+    if (NumFollowing > 0)
+    {
+        UpdateFollowTargets();
+    }
+
+    ++UpdateCounter;
+    if (GTweenLodEnabled)
+    {
+        RefreshLodLevels();
+    }
+
+    // Sort running tweens by where their math should run; paused, queued and cancelled ones are not evaluated
+    GameThreadIndices.Reset();
+    HighPrioIndices.Reset();
+    NormalPrioIndices.Reset();
+    EvaluatedMask.Init(false, Count);
+    const uint32 ReducedInterval = static_cast<uint32>(FMath::Max(1, GTweenLodReducedInterval));
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        if (States[Index] != ETweenState::Running)
+        {
+            continue;
+        }
+
+        // Time always advances at full rate, so LOD never shifts when a tween completes
+        ElapsedTimes[Index] += UpdateTime;
+
+        // Low LOD tweens skip evaluation, but always land exactly on their end value in their final frame
+        if (GTweenLodEnabled && ElapsedTimes[Index] < Durations[Index])
+        {
+            // Properties have no visibility to go by and always update
+            const int32 RecordIndex = WriteRecordIndices[Index];
+            const ETweenLodLevel LodLevel = PropertyIndices[Index] != INDEX_NONE ? ETweenLodLevel::Full
+                : InstanceIndices[Index] != INDEX_NONE ? InstanceBatches[RecordIndex].LodLevel
+                : ParameterIndices[Index] != INDEX_NONE ? ParameterBatches[RecordIndex].LodLevel
+                : WriteRecords[RecordIndex].LodLevel;
+
+            // Reduced tweens are staggered by slot so they do not all land on the same update
+            if (LodLevel == ETweenLodLevel::CompletionOnly
+                || (LodLevel == ETweenLodLevel::Reduced && (UpdateCounter + SlotIndices[Index]) % ReducedInterval != 0))
+            {
+                continue;
+            }
+        }
+
+        EvaluatedMask[Index] = true;
+
+        switch (ThreadingTypes[Index])
+        {
+        case EThreadingType::HighPrio:
+            HighPrioIndices.Add(Index);
+            break;
+
+        case EThreadingType::NormalPrio:
+            NormalPrioIndices.Add(Index);
+            break;
+
+        default:
+            GameThreadIndices.Add(Index);
+            break;
+        }
+    }
+
+#if STATS
+    UpdateTweenCountStats();
+#endif
+    CSV_CUSTOM_STAT(AdvBPTools, ActiveTweens, Count, ECsvCustomStatOp::Set);
+    CSV_CUSTOM_STAT(AdvBPTools, EvaluatedTweens, GameThreadIndices.Num() + HighPrioIndices.Num() + NormalPrioIndices.Num(), ECsvCustomStatOp::Set);
+
+    // Compute phase: worker batches run while the game thread evaluates its own share
+    {
+        SCOPE_CYCLE_COUNTER(STAT_AdvTween_Compute);
+        TRACE_CPUPROFILER_EVENT_SCOPE(AdvTween_Compute);
+
+        LaunchComputeTasks(HighPrioIndices, UE::Tasks::ETaskPriority::High);
+        LaunchComputeTasks(NormalPrioIndices, UE::Tasks::ETaskPriority::Normal);
+        ComputeTweens(GameThreadIndices);
+
+        if (ComputeTasks.Num() > 0)
+        {
+            UE::Tasks::Wait(ComputeTasks);
+            ComputeTasks.Reset();
+        }
+    }
+
+    DirtyWriteRecords.Reset();
+    DirtyInstanceBatches.Reset();
+    DirtyParameterBatches.Reset();
+    FinishedIndices.Reset();
+    FinishedRecords.Reset();
+
+    // Apply phase, first gather every channel into the write record of its actor or instanced component
+    {
+        SCOPE_CYCLE_COUNTER(STAT_AdvTween_Apply);
+        TRACE_CPUPROFILER_EVENT_SCOPE(AdvTween_Apply);
+
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            const ETweenState State = States[Index];
+            if (State == ETweenState::Paused || State == ETweenState::Queued)
+            {
+                continue;
+            }
+
+            if (State == ETweenState::Cancelled || !Targets[Index].IsValid()
+                || (SplinePathIndices[Index] != INDEX_NONE && !SplinePaths[SplinePathIndices[Index]].bValid))
+            {
+                FinishedIndices.Add(Index);
+                FinishedRecords.Add(INDEX_NONE);
+                continue;
+            }
+
+            // Skipped by LOD this update
+            if (!EvaluatedMask[Index])
+            {
+                continue;
+            }
+
+            const int32 RecordIndex = WriteRecordIndices[Index];
+            if (InstanceIndices[Index] != INDEX_NONE)
+            {
+                if (!ApplyInstanceResult(Index))
+                {
+                    FinishedIndices.Add(Index);
+                    FinishedRecords.Add(INDEX_NONE);
+                }
+                else if (ElapsedTimes[Index] >= Durations[Index])
+                {
+                    FinishedIndices.Add(Index);
+                    FinishedRecords.Add(RecordIndex);
+                }
+                continue;
+            }
+
+            if (ParameterIndices[Index] != INDEX_NONE)
+            {
+                ApplyParameterResult(Index);
+                if (ElapsedTimes[Index] >= Durations[Index])
+                {
+                    FinishedIndices.Add(Index);
+                    FinishedRecords.Add(RecordIndex);
+                }
+                continue;
+            }
+
+            // Properties are written straight away, there is nothing to batch
+            if (PropertyIndices[Index] != INDEX_NONE)
+            {
+                WritePropertyResult(Index);
+                if (ElapsedTimes[Index] >= Durations[Index])
+                {
+                    FinishedIndices.Add(Index);
+                    FinishedRecords.Add(PropertyIndices[Index]);
+                }
+                continue;
+            }
+
+            FTweenWriteRecord& Record = WriteRecords[RecordIndex];
+            if (!Record.bDirty)
+            {
+                Record.bDirty = true;
+                DirtyWriteRecords.Add(RecordIndex);
+            }
+            Record.bDeferMovement |= EnumHasAnyFlags(Flags[Index], ETweenFlags::DeferMovement);
+
+            const ETweenChannel Channel = Channels[Index];
+            const bool bAdditive = EnumHasAnyFlags(Flags[Index], ETweenFlags::Additive);
+
+            if (bAdditive)
+            {
+                // Additive tweens contribute only what changed since their last frame
+                Record.AdditiveMask |= ChannelBit(Channel);
+                Record.bSweep |= EnumHasAnyFlags(Flags[Index], ETweenFlags::Sweep);
+
+                switch (Channel)
+                {
+                case ETweenChannel::Location:
+                    Record.LocationIncrement += ResultVectors[Index] - AppliedVectors[Index];
+                    AppliedVectors[Index] = ResultVectors[Index];
+                    break;
+
+                case ETweenChannel::Rotation:
+                    Record.RotationIncrement = ResultQuats[Index] * AppliedQuats[Index].Inverse() * Record.RotationIncrement;
+                    AppliedQuats[Index] = ResultQuats[Index];
+                    break;
+
+                case ETweenChannel::Scale:
+                    Record.ScaleIncrement += ResultVectors[Index] - AppliedVectors[Index];
+                    AppliedVectors[Index] = ResultVectors[Index];
+                    break;
+                }
+            }
+            else if (TrackIndices[Index] != INDEX_NONE)
+            {
+                // Tracks write every channel they drive, owning only their primary one
+                const FTweenTrack& Track = Tracks[TrackIndices[Index]];
+                Record.AbsoluteMask |= Track.ChannelMask;
+                Record.Location = (Track.ChannelMask & ChannelBit(ETweenChannel::Location)) ? Track.Location : Record.Location;
+                Record.Rotation = (Track.ChannelMask & ChannelBit(ETweenChannel::Rotation)) ? Track.Rotation : Record.Rotation;
+                Record.Scale = (Track.ChannelMask & ChannelBit(ETweenChannel::Scale)) ? Track.Scale : Record.Scale;
+                Record.bSweep |= EnumHasAnyFlags(Flags[Index], ETweenFlags::Sweep);
+            }
+            else
+            {
+                Record.AbsoluteMask |= ChannelBit(Channel);
+
+                switch (Channel)
+                {
+                case ETweenChannel::Location:
+                    Record.Location = ResultVectors[Index];
+                    Record.bSweep |= EnumHasAnyFlags(Flags[Index], ETweenFlags::Sweep);
+
+                    // Path tweens facing along their path also write the rotation, without owning that channel
+                    if (EnumHasAnyFlags(Flags[Index], ETweenFlags::OrientToPath))
+                    {
+                        Record.Rotation = ResultQuats[Index];
+                        Record.AbsoluteMask |= ChannelBit(ETweenChannel::Rotation);
+                    }
+                    break;
+
+                case ETweenChannel::Rotation:
+                    Record.Rotation = ResultQuats[Index];
+                    break;
+
+                case ETweenChannel::Scale:
+                    Record.Scale = ResultVectors[Index];
+                    break;
+                }
+            }
+
+            if (ElapsedTimes[Index] >= Durations[Index])
+            {
+                FinishedIndices.Add(Index);
+                FinishedRecords.Add(RecordIndex);
+            }
+        }
+    }
+
+    // Then write each touched actor, instanced component and parameter target once
+    {
+        SCOPE_CYCLE_COUNTER(STAT_AdvTween_Flush);
+        TRACE_CPUPROFILER_EVENT_SCOPE(AdvTween_Flush);
+
+        // Deferred scopes stay open across every record, so a component written by several records, or whose
+        // children are tweened too, updates its overlaps and attached components once when its scope closes
+        int32 MaxMovementScopes = 0;
+        for (const int32 RecordIndex : DirtyWriteRecords)
+        {
+            MaxMovementScopes += GetDeferredMovementComponent(WriteRecords[RecordIndex]) ? 1 : 0;
+        }
+
+        // Scopes register their address with the component, so the storage is reserved up front and never moves
+        TArray<TTypeCompatibleBytes<FScopedMovementUpdate>> MovementScopes;
+        if (MaxMovementScopes > 0)
+        {
+            MovementScopes.Reserve(MaxMovementScopes);
+            for (const int32 RecordIndex : DirtyWriteRecords)
+            {
+                USceneComponent* MovedComponent = GetDeferredMovementComponent(WriteRecords[RecordIndex]);
+                if (MovedComponent && !MovedComponent->IsDeferringMovementUpdates())
+                {
+                    new (MovementScopes[MovementScopes.AddUninitialized()].GetTypedPtr()) FScopedMovementUpdate(MovedComponent, EScopedUpdate::DeferredUpdates);
+                }
+            }
+        }
+
+        for (const int32 RecordIndex : DirtyWriteRecords)
+        {
+            FlushWriteRecord(WriteRecords[RecordIndex]);
+        }
+
+        for (int32 ScopeIndex = MovementScopes.Num() - 1; ScopeIndex >= 0; --ScopeIndex)
+        {
+            DestructItem(MovementScopes[ScopeIndex].GetTypedPtr());
+        }
+
+        for (const int32 BatchIndex : DirtyInstanceBatches)
+        {
+            FlushInstanceBatch(InstanceBatches[BatchIndex]);
+        }
+
+        for (const int32 BatchIndex : DirtyParameterBatches)
+        {
+            FlushParameterBatch(ParameterBatches[BatchIndex]);
+        }
+    }
+
+    bIsUpdating = false;
+
+    if (FinishedIndices.Num() > 0)
+    {
+        RetireFinishedTweens();
+    }
+
+    // Delays count down after the steps of this update have handed off
+    if (NumActiveSequences > 0)
+    {
+        AdvanceSequenceDelays(UpdateTime);
+    }
+}
+
+void UAdvTweenSubsystem::RetireFinishedTweens()
+{
+    SCOPE_CYCLE_COUNTER(STAT_AdvTween_Retire);
+    TRACE_CPUPROFILER_EVENT_SCOPE(AdvTween_Retire);
+
+    // Remove back to front so swapped-in tweens are never ones still waiting for removal
+    PendingNotifies.Reset();
+    for (int32 FinishedIndex = FinishedIndices.Num() - 1; FinishedIndex >= 0; --FinishedIndex)
+    {
+        const int32 Index = FinishedIndices[FinishedIndex];
+        const int32 RecordIndex = FinishedRecords[FinishedIndex];
+        const bool bSuccess = RecordIndex != INDEX_NONE
+            && (PropertyIndices[Index] != INDEX_NONE
+                || (InstanceIndices[Index] != INDEX_NONE ? InstanceBatches[RecordIndex].bWriteSucceeded
+                    : ParameterIndices[Index] != INDEX_NONE ? ParameterBatches[RecordIndex].bWriteSucceeded
+                    : WriteRecords[RecordIndex].bWriteSucceeded));
+
+        // The next group of a sequence picks up the time this step overshot
+        if (bSuccess && SequenceIndices[Index] != INDEX_NONE)
+        {
+            NoteSequenceCarry(SequenceIndices[Index], ElapsedTimes[Index] - Durations[Index]);
+        }
+
+        CountFinishedTween(bSuccess);
+        PendingNotifies.Emplace(MoveTemp(FinishedDelegates[Index]), bSuccess);
+        RemoveTweenAtSwap(Index);
+    }
+
+    // Queued tweens start in the same frame their predecessor finished, from where it left the actor
+    StartQueuedTweens();
+
+    // Notify only after storage is consistent, completion handlers may start new tweens
+    TArray<TPair<FOnAdvTweenFinished, bool>> Notifies = MoveTemp(PendingNotifies);
+    for (int32 NotifyIndex = Notifies.Num() - 1; NotifyIndex >= 0; --NotifyIndex)
+    {
+        Notifies[NotifyIndex].Key.ExecuteIfBound(Notifies[NotifyIndex].Value);
+    }
+    Notifies.Reset();
+    PendingNotifies = MoveTemp(Notifies);
+}
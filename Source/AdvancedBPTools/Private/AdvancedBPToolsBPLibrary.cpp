@@ -2,6 +2,7 @@
 
 #include "AdvancedBPToolsBPLibrary.h"
 #include "AdvancedBPTools.h"
+#include "AdvTweenSubsystem.h"
 #include "Engine/Engine.h"
 #include "Engine/World.h"
 
@@ -10,3 +11,78 @@ UAdvancedBPToolsBPLibrary::UAdvancedBPToolsBPLibrary(const FObjectInitializer& O
 {
 }
 
+template<typename TAction, typename... TArgs>
+void UAdvancedBPToolsBPLibrary::StartLatentAction(UObject* worldContextObject, const FLatentActionInfo& latentInfo, TArgs&&... args)
+{
+    UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(worldContextObject, EGetWorldErrorMode::LogAndReturnNull) : nullptr;
+    if (!World)
+    {
+        return;
+    }
+
+    // Re-triggering a running node keeps the action already in flight, like the engine's own latent nodes
+    FLatentActionManager& LatentActionManager = World->GetLatentActionManager();
+    if (LatentActionManager.FindExistingAction<TAction>(latentInfo.CallbackTarget, latentInfo.UUID) == nullptr)
+    {
+        LatentActionManager.AddNewAction(latentInfo.CallbackTarget, latentInfo.UUID, new TAction(Forward<TArgs>(args)...));
+    }
+}
+
+void UAdvancedBPToolsBPLibrary::MoveActorToLocationLatent(
+    UObject* worldContextObject,
+    AActor* targetActor,
+    FVector desiredLocation,
+    float duration,
+    EEasingFunction easingType,
+    bool bSweep,
+    ELatentActionResult& outResult,
+    FLatentActionInfo latentInfo)
+{
+    outResult = ELatentActionResult::Success;
+
+    // An invalid target still registers the action, which takes the Failed branch on its first update
+    StartLatentAction<FMoveActorToLocationAction>(worldContextObject, latentInfo,
+        targetActor, desiredLocation, duration, bSweep, easingType, latentInfo, outResult);
+}
+
+void UAdvancedBPToolsBPLibrary::RotateActorLatent(
+    UObject* worldContextObject,
+    AActor* targetActor,
+    FRotator desiredRotation,
+    float duration,
+    EEasingFunction easingType,
+    ELatentActionResult& outResult,
+    FLatentActionInfo latentInfo)
+{
+    outResult = ELatentActionResult::Success;
+
+    StartLatentAction<FRotateActorToRotationAction>(worldContextObject, latentInfo,
+        targetActor, desiredRotation, duration, easingType, latentInfo, outResult);
+}
+
+void UAdvancedBPToolsBPLibrary::ScaleActorLatent(
+    UObject* worldContextObject,
+    AActor* targetActor,
+    FVector desiredScale,
+    float duration,
+    EEasingFunction easingType,
+    ELatentActionResult& outResult,
+    FLatentActionInfo latentInfo)
+{
+    outResult = ELatentActionResult::Success;
+
+    StartLatentAction<FScaleActorAction>(worldContextObject, latentInfo,
+        targetActor, desiredScale, duration, easingType, latentInfo, outResult);
+}
+
+bool UAdvancedBPToolsBPLibrary::RetargetTween(UObject* worldContextObject, FAdvTweenHandle tweenHandle, FVector newTarget)
+{
+    UAdvTweenSubsystem* TweenSubsystem = UAdvTweenSubsystem::Get(worldContextObject);
+    return TweenSubsystem && TweenSubsystem->RetargetTween(tweenHandle.Handle, newTarget);
+}
+
+bool UAdvancedBPToolsBPLibrary::RetargetRotationTween(UObject* worldContextObject, FAdvTweenHandle tweenHandle, FRotator newTarget)
+{
+    UAdvTweenSubsystem* TweenSubsystem = UAdvTweenSubsystem::Get(worldContextObject);
+    return TweenSubsystem && TweenSubsystem->RetargetTween(tweenHandle.Handle, newTarget);
+}
@@ -1,9 +1,51 @@
 // Copyright 2025, Wildlight. All Rights Reserved.
 
 #include "AsyncTools.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "Components/SceneComponent.h"
+#include "Components/SplineComponent.h"
 #include "Engine/World.h"
-#include "TimerManager.h"
-#include "AdvBPUtility.h"
+#include "Materials/MaterialParameterCollection.h"
+#include "AdvTweenSubsystem.h"
+#include "AdvTaskPool.h"
+
+//
+// UAdvAsyncTweenTask Implementation
+//
+
+void UAdvAsyncTweenTask::HandleTaskComplete(bool bSuccess)
+{
+    // Broadcast appropriate completion delegate
+    if (bSuccess)
+    {
+        OnSuccess.Broadcast(FAdvTweenHandle(TweenHandle));
+    }
+    else
+    {
+        OnFailed.Broadcast(FAdvTweenHandle(TweenHandle));
+    }
+
+    // Mark the async action as complete
+    SetReadyToDestroy();
+
+    ReturnToPool();
+}
+
+void UAdvAsyncTweenTask::ReturnToPool()
+{
+    // Drop the bindings and references of this run so a recycled instance starts clean
+    OnSuccess.Clear();
+    OnFailed.Clear();
+    WorldContextObject = nullptr;
+    TweenHandle.Reset();
+    ResetTaskReferences();
+
+    if (UAdvTaskPoolSubsystem* TaskPool = UAdvTaskPoolSubsystem::Get(this))
+    {
+        TaskPool->Release(this);
+    }
+}
 
 //
 // UAsyncMoveActorTask Implementation
@@ -16,10 +58,14 @@ UAsyncMoveActorTask* UAsyncMoveActorTask::MoveActor(
     float time,
     EMoveTimingMode timingMode,
     EEasingFunction easingType,
-    bool bSweep)
+    bool bSweep,
+    EThreadingType threadingType,
+    ETweenConflictPolicy conflictPolicy,
+    UCurveFloat* easingCurve)
 {
-    // Create task instance
-    UAsyncMoveActorTask* TaskInstance = NewObject<UAsyncMoveActorTask>();
+    // Create task instance, recycled from the world's pool when possible
+    UAsyncMoveActorTask* TaskInstance = UAdvTaskPoolSubsystem::AcquireTask<UAsyncMoveActorTask>(worldContextObject);
+    TaskInstance->EasingCurve = easingCurve;
 
     // Early validation
     if (!IsValid(targetActor) || time <= KINDA_SMALL_NUMBER)
@@ -31,7 +77,9 @@ UAsyncMoveActorTask* UAsyncMoveActorTask::MoveActor(
             desiredLocation,
             0.001f, // Minimal duration
             easingType,
-            bSweep);
+            bSweep,
+            threadingType,
+            conflictPolicy);
 
         return TaskInstance;
     }
@@ -49,7 +97,7 @@ UAsyncMoveActorTask* UAsyncMoveActorTask::MoveActor(
     {
         // Calculate appropriate duration based on distance and velocity
         const FVector StartLocation = targetActor->GetActorLocation();
-        EffectiveDuration = CalculateDurationFromVelocity(
+        EffectiveDuration = UAdvTweenSubsystem::CalculateDurationFromVelocity(
             StartLocation,
             desiredLocation,
             time);
@@ -69,7 +117,9 @@ UAsyncMoveActorTask* UAsyncMoveActorTask::MoveActor(
         desiredLocation,
         EffectiveDuration,
         easingType,
-        bSweep);
+        bSweep,
+        threadingType,
+        conflictPolicy);
 
     return TaskInstance;
 }
@@ -80,7 +130,9 @@ void UAsyncMoveActorTask::InitializeTask(
     FVector desiredLocation,
     float duration,
     EEasingFunction easingType,
-    bool bSweeps)
+    bool bSweeps,
+    EThreadingType threadingType,
+    ETweenConflictPolicy conflictPolicy)
 {
     // Store parameters
     WorldContextObject = worldContextObject;
@@ -89,25 +141,8 @@ void UAsyncMoveActorTask::InitializeTask(
     Duration = duration;
     EasingType = easingType;
     bSweep = bSweeps;
-    ElapsedTime = 0.0f;
-}
-
-float UAsyncMoveActorTask::CalculateDurationFromVelocity(
-    const FVector& startLocation,
-    const FVector& targetLocation,
-    float velocity)
-{
-    // Calculate distance between points using optimized SIMD operation
-    const float Distance = FVector::Distance(startLocation, targetLocation);
-
-    // Handle edge cases
-    if (Distance <= KINDA_SMALL_NUMBER || velocity <= KINDA_SMALL_NUMBER)
-    {
-        return 0.001f; // Return minimal duration for immediate completion
-    }
-
-    // Calculate duration from distance and velocity
-    return Distance / velocity;
+    ThreadingType = threadingType;
+    ConflictPolicy = conflictPolicy;
 }
 
 void UAsyncMoveActorTask::Activate()
@@ -130,83 +165,42 @@ void UAsyncMoveActorTask::Activate()
         return;
     }
 
-    // Initialize movement
-    InitialLocation = TargetActor->GetActorLocation();
-    ElapsedTime = 0.0f;
-
-    // Setup timer for movement updates
-    UWorld* World = TargetActor ? TargetActor->GetWorld() : nullptr;
-    if (World)
-    {
-        // High frequency timer for smooth movement
-        World->GetTimerManager().SetTimer(
-            TimerHandle,
-            this,
-            &UAsyncMoveActorTask::TickTask,
-            1.0f / 60.0f, // 60 FPS update rate
-            true
-        );
-    }
-    else
-    {
-        HandleTaskComplete(false);
-    }
-}
-
-void UAsyncMoveActorTask::TickTask()
-{
-    // Validate actor is still valid
-    if (!IsValid(TargetActor))
+    // Hand the movement over to the world's tween engine
+    UAdvTweenSubsystem* TweenSubsystem = UAdvTweenSubsystem::Get(TargetActor);
+    if (!TweenSubsystem)
     {
         HandleTaskComplete(false);
         return;
     }
 
-    // Update elapsed time with optimized world time retrieval
-    if (UWorld* World = TargetActor->GetWorld())
+    TweenHandle = TweenSubsystem->StartLocationTween(
+        TargetActor,
+        DesiredLocation,
+        Duration,
+        EMoveTimingMode::Duration,
+        EasingType,
+        bSweep,
+        ThreadingType,
+        ConflictPolicy,
+        FOnAdvTweenFinished::CreateUObject(this, &UAsyncMoveActorTask::HandleTaskComplete));
+
+    // A curve asset overrides the easing function, baked once into a table shared by every tween using it
+    if (EasingCurve)
     {
-        ElapsedTime += World->GetDeltaSeconds();
+        TweenSubsystem->SetTweenEasingCurve(TweenHandle, EasingCurve);
     }
 
-    // Calculate interpolation alpha with bounds checking
-    const float Alpha = FMath::Clamp(ElapsedTime / Duration, 0.0f, 1.0f);
-
-    // Apply easing function
-    const float EasedAlpha = UAdvBPUtilities::ApplyEasing(Alpha, EasingType);
-
-    // Calculate new position using SIMD-optimized lerp
-    const FVector NewLocation = FMath::Lerp(InitialLocation, DesiredLocation, EasedAlpha);
-
-    // Update actor position
-    bool bSuccess = TargetActor->SetActorLocation(NewLocation, bSweep);
-
-    // Check for completion
-    if (ElapsedTime >= Duration)
+    // A tween that failed to start already completed the task and cleared its pins
+    if (TweenSubsystem->IsTweenActive(TweenHandle))
     {
-        HandleTaskComplete(bSuccess);
+        OnStarted.Broadcast(FAdvTweenHandle(TweenHandle));
     }
 }
 
-void UAsyncMoveActorTask::HandleTaskComplete(bool bSuccess)
+void UAsyncMoveActorTask::ResetTaskReferences()
 {
-    // Clear the timer
-    if (UWorld* World = TargetActor ? TargetActor->GetWorld() : nullptr)
-    {
-        World->GetTimerManager().ClearTimer(TimerHandle);
-    }
-
-    // Broadcast appropriate completion delegate
-    if (bSuccess)
-    {
-        OnSuccess.Broadcast();
-    }
-    else
-    {
-        OnFailed.Broadcast();
-    }
-
-    // Mark the async action as complete
-    SetReadyToDestroy();
+    TargetActor = nullptr;
+    EasingCurve = nullptr;
 }
 
 //
@@ -220,10 +214,14 @@ UAsyncRotateActorTask* UAsyncRotateActorTask::RotateActor(
     float time,
     EMoveTimingMode timingMode,
     EEasingFunction easingType,
-    bool bShortestPath)
+    bool bShortestPath,
+    EThreadingType threadingType,
+    ETweenConflictPolicy conflictPolicy,
+    UCurveFloat* easingCurve)
 {
-    // Create task instance
-    UAsyncRotateActorTask* TaskInstance = NewObject<UAsyncRotateActorTask>();
+    // Create task instance, recycled from the world's pool when possible
+    UAsyncRotateActorTask* TaskInstance = UAdvTaskPoolSubsystem::AcquireTask<UAsyncRotateActorTask>(worldContextObject);
+    TaskInstance->EasingCurve = easingCurve;
 
     // Early validation
     if (!IsValid(targetActor) || time <= KINDA_SMALL_NUMBER)
@@ -235,7 +233,9 @@ UAsyncRotateActorTask* UAsyncRotateActorTask::RotateActor(
             desiredRotation,
             0.001f, // Minimal duration
             easingType,
-            bShortestPath);
+            bShortestPath,
+            threadingType,
+            conflictPolicy);
 
         return TaskInstance;
     }
@@ -253,7 +253,7 @@ UAsyncRotateActorTask* UAsyncRotateActorTask::RotateActor(
     {
         // Calculate appropriate duration based on angular distance and velocity
         const FRotator StartRotation = targetActor->GetActorRotation();
-        EffectiveDuration = CalculateDurationFromAngularVelocity(
+        EffectiveDuration = UAdvTweenSubsystem::CalculateDurationFromAngularVelocity(
             StartRotation,
             desiredRotation,
             time);
@@ -273,51 +273,22 @@ UAsyncRotateActorTask* UAsyncRotateActorTask::RotateActor(
         desiredRotation,
         EffectiveDuration,
         easingType,
-        bShortestPath);
+        bShortestPath,
+        threadingType,
+        conflictPolicy);
 
     return TaskInstance;
 }
 
-float UAsyncRotateActorTask::CalculateDurationFromAngularVelocity(
-    const FRotator& startRotation,
-    const FRotator& targetRotation,
-    float degreesPerSecond)
-{
-    // Early validation
-    if (degreesPerSecond <= KINDA_SMALL_NUMBER)
-    {
-        return 0.001f; // Return minimal duration for immediate completion
-    }
-
-    // Convert to quaternions for most accurate angular distance calculation
-    const FQuat StartQuat = startRotation.Quaternion();
-    const FQuat TargetQuat = targetRotation.Quaternion();
-
-    // Calculate angular distance in radians
-    float AngularDistance = 0.0f;
-
-    if (StartQuat.Equals(TargetQuat, KINDA_SMALL_NUMBER))
-    {
-        return 0.001f; // Return minimal duration for immediate completion
-    }
-
-    // Get the angular distance in radians
-    AngularDistance = StartQuat.AngularDistance(TargetQuat);
-
-    // Convert to degrees and calculate duration
-    const float AngularDistanceDegrees = FMath::RadiansToDegrees(AngularDistance);
-
-    // Calculate duration based on angular velocity
-    return AngularDistanceDegrees / degreesPerSecond;
-}
-
 void UAsyncRotateActorTask::InitializeTask(
     UObject* worldContextObject,
     AActor* targetActor,
     FRotator desiredRotation,
     float duration,
     EEasingFunction easingType,
-    bool shortestPath)
+    bool shortestPath,
+    EThreadingType threadingType,
+    ETweenConflictPolicy conflictPolicy)
 {
     // Store parameters
     WorldContextObject = worldContextObject;
@@ -326,7 +297,8 @@ void UAsyncRotateActorTask::InitializeTask(
     Duration = duration;
     EasingType = easingType;
     bShortestPath = shortestPath;
-    ElapsedTime = 0.0f;
+    ThreadingType = threadingType;
+    ConflictPolicy = conflictPolicy;
 }
 
 void UAsyncRotateActorTask::Activate()
@@ -349,95 +321,42 @@ void UAsyncRotateActorTask::Activate()
         return;
     }
 
-    // Initialize rotation and cache quaternions for interpolation
-    InitialRotation = TargetActor->GetActorRotation();
-    InitialQuat = InitialRotation.Quaternion();
-    TargetQuat = DesiredRotation.Quaternion();
-
-    // Ensure we're using the shortest path if requested
-    if (bShortestPath && !FMath::IsNearlyEqual(InitialQuat | TargetQuat, 0.0f, KINDA_SMALL_NUMBER))
-    {
-        if ((InitialQuat | TargetQuat) < 0.0f)
-        {
-            TargetQuat = -TargetQuat;
-        }
-    }
-
-    ElapsedTime = 0.0f;
-
-    // Setup timer for rotation updates
-    UWorld* World = TargetActor ? TargetActor->GetWorld() : nullptr;
-    if (World)
-    {
-        // High frequency timer for smooth rotation
-        World->GetTimerManager().SetTimer(
-            TimerHandle,
-            this,
-            &UAsyncRotateActorTask::TickTask,
-            1.0f / 60.0f, // 60 FPS update rate
-            true
-        );
-    }
-    else
-    {
-        HandleTaskComplete(false);
-    }
-}
-
-void UAsyncRotateActorTask::TickTask()
-{
-    // Validate actor is still valid
-    if (!IsValid(TargetActor))
+    // Hand the rotation over to the world's tween engine
+    UAdvTweenSubsystem* TweenSubsystem = UAdvTweenSubsystem::Get(TargetActor);
+    if (!TweenSubsystem)
     {
         HandleTaskComplete(false);
         return;
     }
 
-    // Update elapsed time with optimized world time retrieval
-    if (UWorld* World = TargetActor->GetWorld())
+    TweenHandle = TweenSubsystem->StartRotationTween(
+        TargetActor,
+        DesiredRotation,
+        Duration,
+        EMoveTimingMode::Duration,
+        EasingType,
+        bShortestPath,
+        ThreadingType,
+        ConflictPolicy,
+        FOnAdvTweenFinished::CreateUObject(this, &UAsyncRotateActorTask::HandleTaskComplete));
+
+    // A curve asset overrides the easing function, baked once into a table shared by every tween using it
+    if (EasingCurve)
     {
-        ElapsedTime += World->GetDeltaSeconds();
+        TweenSubsystem->SetTweenEasingCurve(TweenHandle, EasingCurve);
     }
 
-    // Calculate interpolation alpha with bounds checking
-    const float Alpha = FMath::Clamp(ElapsedTime / Duration, 0.0f, 1.0f);
-
-    // Apply easing function
-    const float EasedAlpha = UAdvBPUtilities::ApplyEasing(Alpha, EasingType);
-
-    // Calculate new rotation using quaternion Slerp for optimal path
-    const FQuat NewQuat = FQuat::Slerp(InitialQuat, TargetQuat, EasedAlpha);
-
-    // Update actor rotation
-    bool bSuccess = TargetActor->SetActorRotation(NewQuat);
-
-    // Check for completion
-    if (ElapsedTime >= Duration)
+    // A tween that failed to start already completed the task and cleared its pins
+    if (TweenSubsystem->IsTweenActive(TweenHandle))
     {
-        HandleTaskComplete(bSuccess);
+        OnStarted.Broadcast(FAdvTweenHandle(TweenHandle));
     }
 }
 
-void UAsyncRotateActorTask::HandleTaskComplete(bool bSuccess)
+void UAsyncRotateActorTask::ResetTaskReferences()
 {
-    // Clear the timer
-    if (UWorld* World = TargetActor ? TargetActor->GetWorld() : nullptr)
-    {
-        World->GetTimerManager().ClearTimer(TimerHandle);
-    }
-
-    // Broadcast appropriate completion delegate
-    if (bSuccess)
-    {
-        OnSuccess.Broadcast();
-    }
-    else
-    {
-        OnFailed.Broadcast();
-    }
-
-    // Mark the async action as complete
-    SetReadyToDestroy();
+    TargetActor = nullptr;
+    EasingCurve = nullptr;
 }
 
 //
@@ -449,10 +368,14 @@ UAsyncScaleActorTask* UAsyncScaleActorTask::ScaleActor(
     AActor* targetActor,
     FVector desiredScale,
     float duration,
-    EEasingFunction easingType)
+    EEasingFunction easingType,
+    EThreadingType threadingType,
+    ETweenConflictPolicy conflictPolicy,
+    UCurveFloat* easingCurve)
 {
-    // Create task instance
-    UAsyncScaleActorTask* TaskInstance = NewObject<UAsyncScaleActorTask>();
+    // Create task instance, recycled from the world's pool when possible
+    UAsyncScaleActorTask* TaskInstance = UAdvTaskPoolSubsystem::AcquireTask<UAsyncScaleActorTask>(worldContextObject);
+    TaskInstance->EasingCurve = easingCurve;
 
     // Early validation
     if (!IsValid(targetActor) || duration <= KINDA_SMALL_NUMBER)
@@ -463,7 +386,9 @@ UAsyncScaleActorTask* UAsyncScaleActorTask::ScaleActor(
             targetActor,
             desiredScale,
             0.001f, // Minimal duration
-            easingType);
+            easingType,
+            threadingType,
+            conflictPolicy);
 
         return TaskInstance;
     }
@@ -476,7 +401,9 @@ UAsyncScaleActorTask* UAsyncScaleActorTask::ScaleActor(
         targetActor,
         desiredScale,
         EffectiveDuration,
-        easingType);
+        easingType,
+        threadingType,
+        conflictPolicy);
 
     return TaskInstance;
 }
@@ -486,7 +413,9 @@ void UAsyncScaleActorTask::InitializeTask(
     AActor* targetActor,
     FVector desiredScale,
     float duration,
-    EEasingFunction easingType)
+    EEasingFunction easingType,
+    EThreadingType threadingType,
+    ETweenConflictPolicy conflictPolicy)
 {
     // Store parameters
     WorldContextObject = worldContextObject;
@@ -494,7 +423,8 @@ void UAsyncScaleActorTask::InitializeTask(
     DesiredScale = desiredScale;
     Duration = duration;
     EasingType = easingType;
-    ElapsedTime = 0.0f;
+    ThreadingType = threadingType;
+    ConflictPolicy = conflictPolicy;
 }
 
 void UAsyncScaleActorTask::Activate()
@@ -517,81 +447,952 @@ void UAsyncScaleActorTask::Activate()
         return;
     }
 
-    // Initialize scale
-    InitialScale = TargetActor->GetActorScale3D();
-    ElapsedTime = 0.0f;
+    // Hand the scaling over to the world's tween engine
+    UAdvTweenSubsystem* TweenSubsystem = UAdvTweenSubsystem::Get(TargetActor);
+    if (!TweenSubsystem)
+    {
+        HandleTaskComplete(false);
+        return;
+    }
 
-    // Setup timer for scale updates
-    UWorld* World = TargetActor ? TargetActor->GetWorld() : nullptr;
-    if (World)
+    TweenHandle = TweenSubsystem->StartScaleTween(
+        TargetActor,
+        DesiredScale,
+        Duration,
+        EasingType,
+        ThreadingType,
+        ConflictPolicy,
+        FOnAdvTweenFinished::CreateUObject(this, &UAsyncScaleActorTask::HandleTaskComplete));
+
+    // A curve asset overrides the easing function, baked once into a table shared by every tween using it
+    if (EasingCurve)
     {
-        // High frequency timer for smooth scaling
-        World->GetTimerManager().SetTimer(
-            TimerHandle,
-            this,
-            &UAsyncScaleActorTask::TickTask,
-            1.0f / 60.0f, // 60 FPS update rate
-            true
-        );
+        TweenSubsystem->SetTweenEasingCurve(TweenHandle, EasingCurve);
+    }
+}
+
+void UAsyncScaleActorTask::ResetTaskReferences()
+{
+    TargetActor = nullptr;
+    EasingCurve = nullptr;
+}
+
+//
+// UAsyncTweenInstanceTask Implementation
+//
+
+UAsyncTweenInstanceTask* UAsyncTweenInstanceTask::MoveInstance(
+    UObject* worldContextObject,
+    UInstancedStaticMeshComponent* component,
+    int32 instanceIndex,
+    FVector desiredLocation,
+    float time,
+    EMoveTimingMode timingMode,
+    EEasingFunction easingType,
+    EThreadingType threadingType)
+{
+    UAsyncTweenInstanceTask* TaskInstance = CreateTask(
+        worldContextObject,
+        component,
+        instanceIndex,
+        ETweenChannel::Location,
+        time,
+        timingMode,
+        easingType,
+        threadingType);
+
+    TaskInstance->DesiredVector = desiredLocation;
+
+    return TaskInstance;
+}
+
+UAsyncTweenInstanceTask* UAsyncTweenInstanceTask::RotateInstance(
+    UObject* worldContextObject,
+    UInstancedStaticMeshComponent* component,
+    int32 instanceIndex,
+    FRotator desiredRotation,
+    float time,
+    EMoveTimingMode timingMode,
+    EEasingFunction easingType,
+    bool bShortestPath,
+    EThreadingType threadingType)
+{
+    UAsyncTweenInstanceTask* TaskInstance = CreateTask(
+        worldContextObject,
+        component,
+        instanceIndex,
+        ETweenChannel::Rotation,
+        time,
+        timingMode,
+        easingType,
+        threadingType);
+
+    TaskInstance->DesiredRotation = desiredRotation;
+    TaskInstance->bShortestPath = bShortestPath;
+
+    return TaskInstance;
+}
+
+UAsyncTweenInstanceTask* UAsyncTweenInstanceTask::ScaleInstance(
+    UObject* worldContextObject,
+    UInstancedStaticMeshComponent* component,
+    int32 instanceIndex,
+    FVector desiredScale,
+    float duration,
+    EEasingFunction easingType,
+    EThreadingType threadingType)
+{
+    UAsyncTweenInstanceTask* TaskInstance = CreateTask(
+        worldContextObject,
+        component,
+        instanceIndex,
+        ETweenChannel::Scale,
+        duration,
+        EMoveTimingMode::Duration,
+        easingType,
+        threadingType);
+
+    TaskInstance->DesiredVector = desiredScale;
+
+    return TaskInstance;
+}
+
+UAsyncTweenInstanceTask* UAsyncTweenInstanceTask::CreateTask(
+    UObject* worldContextObject,
+    UInstancedStaticMeshComponent* component,
+    int32 instanceIndex,
+    ETweenChannel channel,
+    float time,
+    EMoveTimingMode timingMode,
+    EEasingFunction easingType,
+    EThreadingType threadingType)
+{
+    // Create task instance, recycled from the world's pool when possible
+    UAsyncTweenInstanceTask* TaskInstance = UAdvTaskPoolSubsystem::AcquireTask<UAsyncTweenInstanceTask>(worldContextObject);
+
+    // Store parameters; velocity timing is resolved by the tween subsystem from the instance's transform
+    TaskInstance->WorldContextObject = worldContextObject;
+    TaskInstance->Component = component;
+    TaskInstance->InstanceIndex = instanceIndex;
+    TaskInstance->Channel = channel;
+    TaskInstance->Time = FMath::Max(0.001f, time);
+    TaskInstance->TimingMode = timingMode;
+    TaskInstance->EasingType = easingType;
+    TaskInstance->bShortestPath = true;
+    TaskInstance->ThreadingType = threadingType;
+
+    return TaskInstance;
+}
+
+void UAsyncTweenInstanceTask::Activate()
+{
+    // Parent class implementation
+    Super::Activate();
+
+    // Early validation
+    UAdvTweenSubsystem* TweenSubsystem = UAdvTweenSubsystem::Get(Component);
+    if (!IsValid(Component) || !Component->IsValidInstance(InstanceIndex) || !TweenSubsystem)
+    {
+        HandleTaskComplete(false);
+        return;
+    }
+
+    // Hand the instance over to the world's tween engine, which batches it with the rest of the component
+    FOnAdvTweenFinished OnFinished = FOnAdvTweenFinished::CreateUObject(this, &UAsyncTweenInstanceTask::HandleTaskComplete);
+
+    switch (Channel)
+    {
+    case ETweenChannel::Location:
+        TweenHandle = TweenSubsystem->StartInstanceLocationTween(
+            Component,
+            InstanceIndex,
+            DesiredVector,
+            Time,
+            TimingMode,
+            EasingType,
+            ThreadingType,
+            MoveTemp(OnFinished));
+        break;
+
+    case ETweenChannel::Rotation:
+        TweenHandle = TweenSubsystem->StartInstanceRotationTween(
+            Component,
+            InstanceIndex,
+            DesiredRotation,
+            Time,
+            TimingMode,
+            EasingType,
+            bShortestPath,
+            ThreadingType,
+            MoveTemp(OnFinished));
+        break;
+
+    case ETweenChannel::Scale:
+        TweenHandle = TweenSubsystem->StartInstanceScaleTween(
+            Component,
+            InstanceIndex,
+            DesiredVector,
+            Time,
+            EasingType,
+            ThreadingType,
+            MoveTemp(OnFinished));
+        break;
+    }
+}
+
+void UAsyncTweenInstanceTask::ResetTaskReferences()
+{
+    Component = nullptr;
+}
+
+//
+// UAsyncTweenComponentTask Implementation
+//
+
+UAsyncTweenComponentTask* UAsyncTweenComponentTask::MoveComponent(
+    UObject* worldContextObject,
+    USceneComponent* component,
+    FVector desiredLocation,
+    float time,
+    EMoveTimingMode timingMode,
+    EEasingFunction easingType,
+    bool bSweep,
+    EThreadingType threadingType,
+    ETweenConflictPolicy conflictPolicy)
+{
+    UAsyncTweenComponentTask* TaskInstance = CreateTask(
+        worldContextObject,
+        component,
+        ETweenChannel::Location,
+        time,
+        timingMode,
+        easingType,
+        threadingType,
+        conflictPolicy);
+
+    TaskInstance->DesiredVector = desiredLocation;
+    TaskInstance->bSweep = bSweep;
+
+    return TaskInstance;
+}
+
+UAsyncTweenComponentTask* UAsyncTweenComponentTask::RotateComponent(
+    UObject* worldContextObject,
+    USceneComponent* component,
+    FRotator desiredRotation,
+    float time,
+    EMoveTimingMode timingMode,
+    EEasingFunction easingType,
+    bool bShortestPath,
+    EThreadingType threadingType,
+    ETweenConflictPolicy conflictPolicy)
+{
+    UAsyncTweenComponentTask* TaskInstance = CreateTask(
+        worldContextObject,
+        component,
+        ETweenChannel::Rotation,
+        time,
+        timingMode,
+        easingType,
+        threadingType,
+        conflictPolicy);
+
+    TaskInstance->DesiredRotation = desiredRotation;
+    TaskInstance->bShortestPath = bShortestPath;
+
+    return TaskInstance;
+}
+
+UAsyncTweenComponentTask* UAsyncTweenComponentTask::ScaleComponent(
+    UObject* worldContextObject,
+    USceneComponent* component,
+    FVector desiredScale,
+    float duration,
+    EEasingFunction easingType,
+    EThreadingType threadingType,
+    ETweenConflictPolicy conflictPolicy)
+{
+    UAsyncTweenComponentTask* TaskInstance = CreateTask(
+        worldContextObject,
+        component,
+        ETweenChannel::Scale,
+        duration,
+        EMoveTimingMode::Duration,
+        easingType,
+        threadingType,
+        conflictPolicy);
+
+    TaskInstance->DesiredVector = desiredScale;
+
+    return TaskInstance;
+}
+
+UAsyncTweenComponentTask* UAsyncTweenComponentTask::CreateTask(
+    UObject* worldContextObject,
+    USceneComponent* component,
+    ETweenChannel channel,
+    float time,
+    EMoveTimingMode timingMode,
+    EEasingFunction easingType,
+    EThreadingType threadingType,
+    ETweenConflictPolicy conflictPolicy)
+{
+    // Create task instance, recycled from the world's pool when possible
+    UAsyncTweenComponentTask* TaskInstance = UAdvTaskPoolSubsystem::AcquireTask<UAsyncTweenComponentTask>(worldContextObject);
+
+    // Store parameters; velocity timing is resolved by the tween subsystem from the component's relative transform
+    TaskInstance->WorldContextObject = worldContextObject;
+    TaskInstance->Component = component;
+    TaskInstance->Channel = channel;
+    TaskInstance->Time = FMath::Max(0.001f, time);
+    TaskInstance->TimingMode = timingMode;
+    TaskInstance->EasingType = easingType;
+    TaskInstance->bSweep = false;
+    TaskInstance->bShortestPath = true;
+    TaskInstance->ThreadingType = threadingType;
+    TaskInstance->ConflictPolicy = conflictPolicy;
+
+    return TaskInstance;
+}
+
+void UAsyncTweenComponentTask::Activate()
+{
+    // Parent class implementation
+    Super::Activate();
+
+    // Early validation
+    UAdvTweenSubsystem* TweenSubsystem = UAdvTweenSubsystem::Get(Component);
+    if (!IsValid(Component) || !TweenSubsystem)
+    {
+        HandleTaskComplete(false);
+        return;
+    }
+
+    // Hand the component over to the world's tween engine
+    FOnAdvTweenFinished OnFinished = FOnAdvTweenFinished::CreateUObject(this, &UAsyncTweenComponentTask::HandleTaskComplete);
+
+    switch (Channel)
+    {
+    case ETweenChannel::Location:
+        TweenHandle = TweenSubsystem->StartComponentLocationTween(
+            Component,
+            DesiredVector,
+            Time,
+            TimingMode,
+            EasingType,
+            bSweep,
+            ThreadingType,
+            ConflictPolicy,
+            MoveTemp(OnFinished));
+        break;
+
+    case ETweenChannel::Rotation:
+        TweenHandle = TweenSubsystem->StartComponentRotationTween(
+            Component,
+            DesiredRotation,
+            Time,
+            TimingMode,
+            EasingType,
+            bShortestPath,
+            ThreadingType,
+            ConflictPolicy,
+            MoveTemp(OnFinished));
+        break;
+
+    case ETweenChannel::Scale:
+        TweenHandle = TweenSubsystem->StartComponentScaleTween(
+            Component,
+            DesiredVector,
+            Time,
+            EasingType,
+            ThreadingType,
+            ConflictPolicy,
+            MoveTemp(OnFinished));
+        break;
+    }
+}
+
+void UAsyncTweenComponentTask::ResetTaskReferences()
+{
+    Component = nullptr;
+}
+
+//
+// UAsyncTweenMaterialParameterTask Implementation
+//
+
+UAsyncTweenMaterialParameterTask* UAsyncTweenMaterialParameterTask::TweenPrimitiveDataScalar(
+    UObject* worldContextObject,
+    UPrimitiveComponent* component,
+    int32 dataIndex,
+    float desiredValue,
+    float duration,
+    EEasingFunction easingType,
+    EThreadingType threadingType)
+{
+    UAsyncTweenMaterialParameterTask* TaskInstance = CreateTask(
+        worldContextObject,
+        FLinearColor(desiredValue, 0.0f, 0.0f, 0.0f),
+        false,
+        duration,
+        easingType,
+        threadingType);
+
+    TaskInstance->Component = component;
+    TaskInstance->DataIndex = dataIndex;
+
+    return TaskInstance;
+}
+
+UAsyncTweenMaterialParameterTask* UAsyncTweenMaterialParameterTask::TweenPrimitiveDataVector(
+    UObject* worldContextObject,
+    UPrimitiveComponent* component,
+    int32 dataIndex,
+    FLinearColor desiredValue,
+    float duration,
+    EEasingFunction easingType,
+    EThreadingType threadingType)
+{
+    UAsyncTweenMaterialParameterTask* TaskInstance = CreateTask(
+        worldContextObject,
+        desiredValue,
+        true,
+        duration,
+        easingType,
+        threadingType);
+
+    TaskInstance->Component = component;
+    TaskInstance->DataIndex = dataIndex;
+
+    return TaskInstance;
+}
+
+UAsyncTweenMaterialParameterTask* UAsyncTweenMaterialParameterTask::TweenCollectionScalar(
+    UObject* worldContextObject,
+    UMaterialParameterCollection* collection,
+    FName parameterName,
+    float desiredValue,
+    float duration,
+    EEasingFunction easingType,
+    EThreadingType threadingType)
+{
+    UAsyncTweenMaterialParameterTask* TaskInstance = CreateTask(
+        worldContextObject,
+        FLinearColor(desiredValue, 0.0f, 0.0f, 0.0f),
+        false,
+        duration,
+        easingType,
+        threadingType);
+
+    TaskInstance->Collection = collection;
+    TaskInstance->ParameterName = parameterName;
+
+    return TaskInstance;
+}
+
+UAsyncTweenMaterialParameterTask* UAsyncTweenMaterialParameterTask::TweenCollectionVector(
+    UObject* worldContextObject,
+    UMaterialParameterCollection* collection,
+    FName parameterName,
+    FLinearColor desiredValue,
+    float duration,
+    EEasingFunction easingType,
+    EThreadingType threadingType)
+{
+    UAsyncTweenMaterialParameterTask* TaskInstance = CreateTask(
+        worldContextObject,
+        desiredValue,
+        true,
+        duration,
+        easingType,
+        threadingType);
+
+    TaskInstance->Collection = collection;
+    TaskInstance->ParameterName = parameterName;
+
+    return TaskInstance;
+}
+
+UAsyncTweenMaterialParameterTask* UAsyncTweenMaterialParameterTask::CreateTask(
+    UObject* worldContextObject,
+    const FLinearColor& desiredValue,
+    bool bVector,
+    float duration,
+    EEasingFunction easingType,
+    EThreadingType threadingType)
+{
+    // Create task instance, recycled from the world's pool when possible
+    UAsyncTweenMaterialParameterTask* TaskInstance = UAdvTaskPoolSubsystem::AcquireTask<UAsyncTweenMaterialParameterTask>(worldContextObject);
+
+    // Store parameters; the target is set by the factory of each parameter kind
+    TaskInstance->WorldContextObject = worldContextObject;
+    TaskInstance->Component = nullptr;
+    TaskInstance->Collection = nullptr;
+    TaskInstance->ParameterName = NAME_None;
+    TaskInstance->DataIndex = 0;
+    TaskInstance->DesiredValue = desiredValue;
+    TaskInstance->bVector = bVector;
+    TaskInstance->Duration = FMath::Max(0.001f, duration);
+    TaskInstance->EasingType = easingType;
+    TaskInstance->ThreadingType = threadingType;
+
+    return TaskInstance;
+}
+
+void UAsyncTweenMaterialParameterTask::Activate()
+{
+    // Parent class implementation
+    Super::Activate();
+
+    // Early validation
+    UAdvTweenSubsystem* TweenSubsystem = UAdvTweenSubsystem::Get(WorldContextObject);
+    if (!TweenSubsystem || (!IsValid(Component) && !IsValid(Collection)))
+    {
+        HandleTaskComplete(false);
+        return;
+    }
+
+    // Hand the parameter over to the world's tween engine, which batches it with the rest of its target
+    FOnAdvTweenFinished OnFinished = FOnAdvTweenFinished::CreateUObject(this, &UAsyncTweenMaterialParameterTask::HandleTaskComplete);
+
+    if (Component)
+    {
+        TweenHandle = bVector
+            ? TweenSubsystem->StartPrimitiveDataVectorTween(Component, DataIndex, DesiredValue, Duration, EasingType, ThreadingType, MoveTemp(OnFinished))
+            : TweenSubsystem->StartPrimitiveDataScalarTween(Component, DataIndex, DesiredValue.R, Duration, EasingType, ThreadingType, MoveTemp(OnFinished));
     }
     else
+    {
+        TweenHandle = bVector
+            ? TweenSubsystem->StartCollectionVectorTween(Collection, ParameterName, DesiredValue, Duration, EasingType, ThreadingType, MoveTemp(OnFinished))
+            : TweenSubsystem->StartCollectionScalarTween(Collection, ParameterName, DesiredValue.R, Duration, EasingType, ThreadingType, MoveTemp(OnFinished));
+    }
+
+    // Rejected parameters never start, so nothing else would report them
+    if (!TweenHandle.IsSet())
     {
         HandleTaskComplete(false);
     }
 }
 
-void UAsyncScaleActorTask::TickTask()
+void UAsyncTweenMaterialParameterTask::ResetTaskReferences()
 {
-    // Validate actor is still valid
-    if (!IsValid(TargetActor))
+    Component = nullptr;
+    Collection = nullptr;
+}
+
+//
+// UAsyncTweenPropertyTask Implementation
+//
+
+UAsyncTweenPropertyTask* UAsyncTweenPropertyTask::TweenFloatProperty(
+    UObject* worldContextObject,
+    UObject* target,
+    FName propertyName,
+    float desiredValue,
+    float duration,
+    EEasingFunction easingType,
+    EThreadingType threadingType)
+{
+    return CreateTask(
+        worldContextObject,
+        target,
+        propertyName,
+        TAdvTweenPropertyTraits<float>::Type,
+        TAdvTweenPropertyTraits<float>::Pack(desiredValue),
+        duration,
+        easingType,
+        threadingType);
+}
+
+UAsyncTweenPropertyTask* UAsyncTweenPropertyTask::TweenVectorProperty(
+    UObject* worldContextObject,
+    UObject* target,
+    FName propertyName,
+    FVector desiredValue,
+    float duration,
+    EEasingFunction easingType,
+    EThreadingType threadingType)
+{
+    return CreateTask(
+        worldContextObject,
+        target,
+        propertyName,
+        TAdvTweenPropertyTraits<FVector>::Type,
+        TAdvTweenPropertyTraits<FVector>::Pack(desiredValue),
+        duration,
+        easingType,
+        threadingType);
+}
+
+UAsyncTweenPropertyTask* UAsyncTweenPropertyTask::TweenRotatorProperty(
+    UObject* worldContextObject,
+    UObject* target,
+    FName propertyName,
+    FRotator desiredValue,
+    float duration,
+    EEasingFunction easingType,
+    EThreadingType threadingType)
+{
+    return CreateTask(
+        worldContextObject,
+        target,
+        propertyName,
+        TAdvTweenPropertyTraits<FRotator>::Type,
+        TAdvTweenPropertyTraits<FRotator>::Pack(desiredValue),
+        duration,
+        easingType,
+        threadingType);
+}
+
+UAsyncTweenPropertyTask* UAsyncTweenPropertyTask::TweenColorProperty(
+    UObject* worldContextObject,
+    UObject* target,
+    FName propertyName,
+    FLinearColor desiredValue,
+    float duration,
+    EEasingFunction easingType,
+    EThreadingType threadingType)
+{
+    return CreateTask(
+        worldContextObject,
+        target,
+        propertyName,
+        TAdvTweenPropertyTraits<FLinearColor>::Type,
+        TAdvTweenPropertyTraits<FLinearColor>::Pack(desiredValue),
+        duration,
+        easingType,
+        threadingType);
+}
+
+UAsyncTweenPropertyTask* UAsyncTweenPropertyTask::CreateTask(
+    UObject* worldContextObject,
+    UObject* target,
+    FName propertyName,
+    ETweenPropertyType propertyType,
+    const FVector4d& desiredValue,
+    float duration,
+    EEasingFunction easingType,
+    EThreadingType threadingType)
+{
+    // Create task instance, recycled from the world's pool when possible
+    UAsyncTweenPropertyTask* TaskInstance = UAdvTaskPoolSubsystem::AcquireTask<UAsyncTweenPropertyTask>(worldContextObject);
+
+    // Store parameters
+    TaskInstance->WorldContextObject = worldContextObject;
+    TaskInstance->Target = target;
+    TaskInstance->PropertyName = propertyName;
+    TaskInstance->PropertyType = propertyType;
+    TaskInstance->DesiredValue = desiredValue;
+    TaskInstance->Duration = FMath::Max(0.001f, duration);
+    TaskInstance->EasingType = easingType;
+    TaskInstance->ThreadingType = threadingType;
+
+    return TaskInstance;
+}
+
+void UAsyncTweenPropertyTask::Activate()
+{
+    // Parent class implementation
+    Super::Activate();
+
+    // Early validation
+    UAdvTweenSubsystem* TweenSubsystem = UAdvTweenSubsystem::Get(WorldContextObject);
+    if (!TweenSubsystem || !IsValid(Target))
     {
         HandleTaskComplete(false);
         return;
     }
 
-    // Update elapsed time with optimized world time retrieval
-    if (UWorld* World = TargetActor->GetWorld())
+    // Hand the property over to the world's tween engine, which resolves it once and writes it directly
+    FOnAdvTweenFinished OnFinished = FOnAdvTweenFinished::CreateUObject(this, &UAsyncTweenPropertyTask::HandleTaskComplete);
+
+    switch (PropertyType)
     {
-        ElapsedTime += World->GetDeltaSeconds();
+    case ETweenPropertyType::Vector:
+        TweenHandle = TweenSubsystem->StartPropertyTween(
+            Target, PropertyName, TAdvTweenPropertyTraits<FVector>::Unpack(DesiredValue), Duration, EasingType, ThreadingType, MoveTemp(OnFinished));
+        break;
+
+    case ETweenPropertyType::Rotator:
+        TweenHandle = TweenSubsystem->StartPropertyTween(
+            Target, PropertyName, TAdvTweenPropertyTraits<FRotator>::Unpack(DesiredValue), Duration, EasingType, ThreadingType, MoveTemp(OnFinished));
+        break;
+
+    case ETweenPropertyType::LinearColor:
+        TweenHandle = TweenSubsystem->StartPropertyTween(
+            Target, PropertyName, TAdvTweenPropertyTraits<FLinearColor>::Unpack(DesiredValue), Duration, EasingType, ThreadingType, MoveTemp(OnFinished));
+        break;
+
+    default:
+        TweenHandle = TweenSubsystem->StartPropertyTween(
+            Target, PropertyName, TAdvTweenPropertyTraits<double>::Unpack(DesiredValue), Duration, EasingType, ThreadingType, MoveTemp(OnFinished));
+        break;
     }
 
-    // Calculate interpolation alpha with bounds checking
-    const float Alpha = FMath::Clamp(ElapsedTime / Duration, 0.0f, 1.0f);
+    // Missing or mismatched properties never start, so nothing else would report them
+    if (!TweenHandle.IsSet())
+    {
+        HandleTaskComplete(false);
+    }
+}
 
-    // Apply easing function
-    const float EasedAlpha = UAdvBPUtilities::ApplyEasing(Alpha, EasingType);
+void UAsyncTweenPropertyTask::ResetTaskReferences()
+{
+    Target = nullptr;
+}
 
-    // Calculate new scale using SIMD-optimized lerp
-    const FVector NewScale = FMath::Lerp(InitialScale, DesiredScale, EasedAlpha);
+//
+// UAsyncMoveAlongSplineTask Implementation
+//
 
-    // Update actor scale
-    TargetActor->SetActorScale3D(NewScale);
+UAsyncMoveAlongSplineTask* UAsyncMoveAlongSplineTask::MoveActorAlongSpline(
+    UObject* worldContextObject,
+    AActor* targetActor,
+    USplineComponent* spline,
+    float time,
+    EMoveTimingMode timingMode,
+    EEasingFunction easingType,
+    bool bOrientToSpline,
+    bool bReverse,
+    EThreadingType threadingType,
+    ETweenConflictPolicy conflictPolicy)
+{
+    // Create task instance, recycled from the world's pool when possible
+    UAsyncMoveAlongSplineTask* TaskInstance = UAdvTaskPoolSubsystem::AcquireTask<UAsyncMoveAlongSplineTask>(worldContextObject);
+
+    // Store parameters; the spline length is only known to the tween subsystem's arc-length table
+    TaskInstance->WorldContextObject = worldContextObject;
+    TaskInstance->TargetActor = targetActor;
+    TaskInstance->Spline = spline;
+    TaskInstance->Time = FMath::Max(0.001f, time);
+    TaskInstance->TimingMode = timingMode;
+    TaskInstance->EasingType = easingType;
+    TaskInstance->bOrientToSpline = bOrientToSpline;
+    TaskInstance->bReverse = bReverse;
+    TaskInstance->ThreadingType = threadingType;
+    TaskInstance->ConflictPolicy = conflictPolicy;
 
-    // Check for completion
-    if (ElapsedTime >= Duration)
+    return TaskInstance;
+}
+
+void UAsyncMoveAlongSplineTask::Activate()
+{
+    // Parent class implementation
+    Super::Activate();
+
+    // Early validation
+    UAdvTweenSubsystem* TweenSubsystem = UAdvTweenSubsystem::Get(TargetActor);
+    if (!IsValid(TargetActor) || !IsValid(Spline) || !TweenSubsystem)
     {
-        HandleTaskComplete(true);
+        HandleTaskComplete(false);
+        return;
+    }
+
+    // Hand the movement over to the world's tween engine
+    TweenHandle = TweenSubsystem->StartSplineTween(
+        TargetActor,
+        Spline,
+        Time,
+        TimingMode,
+        EasingType,
+        bOrientToSpline,
+        bReverse,
+        ThreadingType,
+        ConflictPolicy,
+        FOnAdvTweenFinished::CreateUObject(this, &UAsyncMoveAlongSplineTask::HandleTaskComplete));
+}
+
+void UAsyncMoveAlongSplineTask::ResetTaskReferences()
+{
+    TargetActor = nullptr;
+    Spline = nullptr;
+}
+
+//
+// UAsyncMoveToActorTask Implementation
+//
+
+UAsyncMoveToActorTask* UAsyncMoveToActorTask::MoveActorToActor(
+    UObject* worldContextObject,
+    AActor* targetActor,
+    AActor* followActor,
+    FVector locationOffset,
+    float duration,
+    EEasingFunction easingType,
+    bool bSweep,
+    EThreadingType threadingType,
+    ETweenConflictPolicy conflictPolicy)
+{
+    // Create task instance, recycled from the world's pool when possible
+    UAsyncMoveToActorTask* TaskInstance = UAdvTaskPoolSubsystem::AcquireTask<UAsyncMoveToActorTask>(worldContextObject);
+
+    // Store parameters
+    TaskInstance->WorldContextObject = worldContextObject;
+    TaskInstance->TargetActor = targetActor;
+    TaskInstance->FollowActor = followActor;
+    TaskInstance->LocationOffset = locationOffset;
+    TaskInstance->Duration = FMath::Max(0.001f, duration);
+    TaskInstance->EasingType = easingType;
+    TaskInstance->bSweep = bSweep;
+    TaskInstance->ThreadingType = threadingType;
+    TaskInstance->ConflictPolicy = conflictPolicy;
+
+    return TaskInstance;
+}
+
+void UAsyncMoveToActorTask::Activate()
+{
+    // Parent class implementation
+    Super::Activate();
+
+    // Early validation
+    UAdvTweenSubsystem* TweenSubsystem = UAdvTweenSubsystem::Get(TargetActor);
+    if (!IsValid(TargetActor) || !IsValid(FollowActor) || !TweenSubsystem)
+    {
+        HandleTaskComplete(false);
+        return;
     }
+
+    // Head for where the followed actor is now, the subsystem retargets as it moves
+    TweenHandle = TweenSubsystem->StartLocationTween(
+        TargetActor,
+        FollowActor->GetActorLocation() + LocationOffset,
+        Duration,
+        EMoveTimingMode::Duration,
+        EasingType,
+        bSweep,
+        ThreadingType,
+        ConflictPolicy,
+        FOnAdvTweenFinished::CreateUObject(this, &UAsyncMoveToActorTask::HandleTaskComplete));
+
+    TweenSubsystem->SetTweenFollowTarget(TweenHandle, FollowActor, LocationOffset);
+}
+
+void UAsyncMoveToActorTask::ResetTaskReferences()
+{
+    TargetActor = nullptr;
+    FollowActor = nullptr;
+}
+
+//
+// UAsyncPlayKeyframesTask Implementation
+//
+
+UAsyncPlayKeyframesTask* UAsyncPlayKeyframesTask::PlayKeyframeTrack(
+    UObject* worldContextObject,
+    AActor* targetActor,
+    const TArray<FAdvTransformKey>& keys,
+    bool bDriveLocation,
+    bool bDriveRotation,
+    bool bDriveScale,
+    bool bSweep,
+    EThreadingType threadingType,
+    ETweenConflictPolicy conflictPolicy)
+{
+    // Create task instance, recycled from the world's pool when possible
+    UAsyncPlayKeyframesTask* TaskInstance = UAdvTaskPoolSubsystem::AcquireTask<UAsyncPlayKeyframesTask>(worldContextObject);
+
+    // Store parameters; the key array keeps its allocation across pooled runs
+    TaskInstance->WorldContextObject = worldContextObject;
+    TaskInstance->TargetActor = targetActor;
+    TaskInstance->Keys = keys;
+    TaskInstance->bDriveLocation = bDriveLocation;
+    TaskInstance->bDriveRotation = bDriveRotation;
+    TaskInstance->bDriveScale = bDriveScale;
+    TaskInstance->bSweep = bSweep;
+    TaskInstance->ThreadingType = threadingType;
+    TaskInstance->ConflictPolicy = conflictPolicy;
+
+    return TaskInstance;
 }
 
-void UAsyncScaleActorTask::HandleTaskComplete(bool bSuccess)
+void UAsyncPlayKeyframesTask::Activate()
 {
-    // Clear the timer
-    if (UWorld* World = TargetActor ? TargetActor->GetWorld() : nullptr)
+    // Parent class implementation
+    Super::Activate();
+
+    // Early validation
+    UAdvTweenSubsystem* TweenSubsystem = UAdvTweenSubsystem::Get(TargetActor);
+    if (!IsValid(TargetActor) || Keys.Num() == 0 || !TweenSubsystem)
     {
-        World->GetTimerManager().ClearTimer(TimerHandle);
+        HandleTaskComplete(false);
+        return;
     }
 
-    // Broadcast appropriate completion delegate
-    if (bSuccess)
+    // Hand the track over to the world's tween engine, which copies the keys
+    TweenHandle = TweenSubsystem->StartKeyframeTween(
+        TargetActor,
+        Keys,
+        bDriveLocation,
+        bDriveRotation,
+        bDriveScale,
+        bSweep,
+        ThreadingType,
+        ConflictPolicy,
+        FOnAdvTweenFinished::CreateUObject(this, &UAsyncPlayKeyframesTask::HandleTaskComplete));
+
+    if (!TweenHandle.IsSet())
     {
-        OnSuccess.Broadcast();
+        HandleTaskComplete(false);
     }
-    else
+}
+
+void UAsyncPlayKeyframesTask::ResetTaskReferences()
+{
+    TargetActor = nullptr;
+    Keys.Reset();
+}
+
+//
+// UAsyncPlayTweenSequenceTask Implementation
+//
+
+UAsyncPlayTweenSequenceTask* UAsyncPlayTweenSequenceTask::PlayTweenSequence(
+    UObject* worldContextObject,
+    AActor* targetActor,
+    const TArray<FAdvTweenStep>& steps,
+    bool bSweep,
+    EThreadingType threadingType)
+{
+    // Create task instance, recycled from the world's pool when possible
+    UAsyncPlayTweenSequenceTask* TaskInstance = UAdvTaskPoolSubsystem::AcquireTask<UAsyncPlayTweenSequenceTask>(worldContextObject);
+
+    // Store parameters
+    TaskInstance->WorldContextObject = worldContextObject;
+    TaskInstance->TargetActor = targetActor;
+    TaskInstance->Steps = steps;
+    TaskInstance->bSweep = bSweep;
+    TaskInstance->ThreadingType = threadingType;
+
+    return TaskInstance;
+}
+
+void UAsyncPlayTweenSequenceTask::Activate()
+{
+    // Parent class implementation
+    Super::Activate();
+
+    // Early validation
+    UAdvTweenSubsystem* TweenSubsystem = UAdvTweenSubsystem::Get(TargetActor);
+    if (!IsValid(TargetActor) || Steps.Num() == 0 || !TweenSubsystem)
     {
-        OnFailed.Broadcast();
+        HandleTaskComplete(false);
+        return;
     }
 
-    // Mark the async action as complete
-    SetReadyToDestroy();
-}
\ No newline at end of file
+    // The whole sequence runs inside the tween subsystem, this task only hears about its end
+    SequenceHandle = TweenSubsystem->StartTweenSequence(
+        TargetActor,
+        Steps,
+        bSweep,
+        ThreadingType,
+        FOnAdvTweenFinished::CreateUObject(this, &UAsyncPlayTweenSequenceTask::HandleTaskComplete));
+}
+
+void UAsyncPlayTweenSequenceTask::ResetTaskReferences()
+{
+    TargetActor = nullptr;
+    Steps.Reset();
+    SequenceHandle.Reset();
+}
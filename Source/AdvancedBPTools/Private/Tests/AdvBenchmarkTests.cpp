@@ -0,0 +1,49 @@
+// Copyright 2025, Wildlight. All Rights Reserved.
+
+#include "AdvBenchmark.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAdvScaleBenchmarkTest, "AdvBPTools.Benchmark.Scale",
+    EAutomationTestFlags::EditorContext | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::PerfFilter)
+
+bool FAdvScaleBenchmarkTest::RunTest(const FString& parameters)
+{
+    const TArray<int32> TweenCounts = { 1000, 10000, 100000 };
+    constexpr int32 NumFrames = 120;
+
+    UWorld* World = FAdvBenchmark::CreateBenchmarkWorld();
+    if (!TestNotNull(TEXT("Headless benchmark world"), World))
+    {
+        return false;
+    }
+
+    const TArray<FAdvScaleBenchmarkResult> Results = FAdvBenchmark::RunScaleSuite(World, TweenCounts, NumFrames);
+    FAdvBenchmark::DestroyBenchmarkWorld(World);
+
+    // Move, rotate and scale at every count, each with every tween started and advanced
+    TestEqual(TEXT("Number of runs"), Results.Num(), TweenCounts.Num() * 3);
+    for (int32 Index = 0; Index < Results.Num(); ++Index)
+    {
+        const FAdvScaleBenchmarkResult& Result = Results[Index];
+        TestEqual(TEXT("Tweens started"), Result.NumTweens, TweenCounts[Index / 3]);
+        TestEqual(TEXT("Frames advanced"), Result.NumFrames, NumFrames);
+        TestTrue(TEXT("Frames were timed"), Result.AvgFrameMs > 0.0 && Result.MaxFrameMs >= Result.AvgFrameMs);
+    }
+
+    // Same CSV as the AdvScaleBenchmark commandlet, so runs from either can be compared
+    const TArray<FString> Rows = FAdvBenchmark::ToCsvRows(Results);
+    for (const FString& Row : Rows)
+    {
+        AddInfo(Row);
+    }
+
+    const FString OutputPath = FAdvBenchmark::GetDefaultScaleCsvPath();
+    TestTrue(*FString::Printf(TEXT("Wrote %s"), *OutputPath), FFileHelper::SaveStringArrayToFile(Rows, *OutputPath));
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
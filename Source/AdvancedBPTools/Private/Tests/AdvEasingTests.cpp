@@ -0,0 +1,51 @@
+// Copyright 2025, Wildlight. All Rights Reserved.
+
+#include "AdvBenchmark.h"
+#include "AdvBPUtility.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAdvEasingAccuracyTest, "AdvBPTools.Easing.Accuracy",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FAdvEasingAccuracyTest::RunTest(const FString& parameters)
+{
+    for (const FAdvEasingAccuracyResult& Result : FAdvBenchmark::CheckEasingAccuracy(100001))
+    {
+        const FString CurveName = UEnum::GetValueAsString(Result.EasingType);
+
+        // ApplyEasing against the double precision curve, the faster paths against ApplyEasing
+        TestTrue(*FString::Printf(TEXT("%s ApplyEasing error %.3e within bound"), *CurveName, Result.ApplyEasingMaxError),
+            Result.ApplyEasingMaxError <= FAdvBenchmark::EasingAccuracyTolerance);
+        TestTrue(*FString::Printf(TEXT("%s kernel error %.3e within bound"), *CurveName, Result.KernelMaxError),
+            Result.KernelMaxError <= Result.ApplyEasingMaxError + FAdvBenchmark::EasingAccuracyTolerance);
+        TestTrue(*FString::Printf(TEXT("%s batch error %.3e within bound"), *CurveName, Result.BatchMaxError),
+            Result.BatchMaxError <= Result.ApplyEasingMaxError + FAdvBenchmark::EasingAccuracyTolerance);
+        TestTrue(*FString::Printf(TEXT("%s endpoints exact on every path"), *CurveName),
+            Result.bApplyEasingEndpointsExact && Result.bKernelEndpointsExact && Result.bBatchEndpointsExact);
+    }
+
+    // The exponential curves only reach 0 and 1 through their special cases, so check those values bit for bit
+    const float EndpointAlphas[] = { 0.0f, 1.0f };
+    float BatchOutput[2];
+
+    for (const EEasingFunction EasingType : { EEasingFunction::ExpoIn, EEasingFunction::ExpoOut, EEasingFunction::ExpoInOut })
+    {
+        const FString CurveName = UEnum::GetValueAsString(EasingType);
+        const FEasingKernel Kernel = UAdvBPUtilities::ResolveEasingKernel(EasingType);
+        UAdvBPUtilities::ApplyEasingBatch(EndpointAlphas, EasingType, BatchOutput);
+
+        for (int32 Index = 0; Index < UE_ARRAY_COUNT(EndpointAlphas); ++Index)
+        {
+            const float Alpha = EndpointAlphas[Index];
+            TestTrue(*FString::Printf(TEXT("%s ApplyEasing(%.0f) exact"), *CurveName, Alpha), UAdvBPUtilities::ApplyEasing(Alpha, EasingType) == Alpha);
+            TestTrue(*FString::Printf(TEXT("%s kernel(%.0f) exact"), *CurveName, Alpha), Kernel(Alpha) == Alpha);
+            TestTrue(*FString::Printf(TEXT("%s batch(%.0f) exact"), *CurveName, Alpha), BatchOutput[Index] == Alpha);
+        }
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -13,6 +13,15 @@ enum class EEasingFunction : uint8
     ExpoInOut   UMETA(DisplayName = "Exponential In Out")
 };
 
+UENUM(BlueprintType)
+enum class EEasingPrecision : uint8
+{
+    Exact       UMETA(DisplayName = "Exact", ToolTip = "Evaluates the curve analytically"),
+    Table64     UMETA(DisplayName = "Table (64 entries)", ToolTip = "Interpolates a shared 64 entry table, coarsest and smallest"),
+    Table256    UMETA(DisplayName = "Table (256 entries)", ToolTip = "Interpolates a shared 256 entry table"),
+    Table1024   UMETA(DisplayName = "Table (1024 entries)", ToolTip = "Interpolates a shared 1024 entry table, closest to exact")
+};
+
 UENUM(BlueprintType)
 enum class EMoveTimingMode : uint8
 {
@@ -26,4 +35,28 @@ enum class EThreadingType : uint8
     GameThread UMETA(DisplayName = "Game Thread", ToolTip = "Runs asyncronsly in the game thread"),
     HighPrio UMETA(DisplayName = "HiPrioThread", ToolTip = "Runs asyncronsly on any high priority background thread"),
     NormalPrio UMETA(DisplayName = "NormalThread", ToolTip = "Runs asyncronsly on any normal priority background thread")
-};
\ No newline at end of file
+};
+
+UENUM(BlueprintType)
+enum class ETweenConflictPolicy : uint8
+{
+    Replace UMETA(DisplayName = "Replace", ToolTip = "Cancels the tweens already driving the same channel of the actor, which report failure"),
+    Queue UMETA(DisplayName = "Queue", ToolTip = "Waits until the tweens already driving the same channel finish, then starts from wherever they left the actor"),
+    Additive UMETA(DisplayName = "Additive", ToolTip = "Runs alongside other tweens on the same channel, adding its change on top of theirs")
+};
+
+UENUM(BlueprintType)
+enum class ELatentActionResult : uint8
+{
+    Success UMETA(DisplayName = "Success", ToolTip = "The action ran to the end"),
+    Failed UMETA(DisplayName = "Failed", ToolTip = "The target went away or a sweep could not move it at all")
+};
+
+UENUM(BlueprintType)
+enum class ETweenStepType : uint8
+{
+    Move UMETA(DisplayName = "Move", ToolTip = "Moves the actor to the step's vector"),
+    Rotate UMETA(DisplayName = "Rotate", ToolTip = "Rotates the actor to the step's rotation along the shortest path"),
+    Scale UMETA(DisplayName = "Scale", ToolTip = "Scales the actor to the step's vector"),
+    Delay UMETA(DisplayName = "Delay", ToolTip = "Waits for the step's duration without touching the actor")
+};
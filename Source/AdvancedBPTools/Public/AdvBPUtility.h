@@ -7,6 +7,11 @@
 #include "AdvBPTypes.h"
 #include "AdvBPUtility.generated.h"
 
+class UCurveFloat;
+
+/** Easing curve resolved ahead of time; expects alpha already in range 0.0-1.0 */
+using FEasingKernel = float (*)(float alpha);
+
 /**
  * High-performance utility library for easing functions
  * Provides optimized interpolation calculations for animation and movement
@@ -27,6 +32,62 @@ public:
     UFUNCTION(BlueprintPure, Category = "AdvBPTools|Math|Interpolation")
     static float ApplyEasing(float alpha, EEasingFunction easingType);
 
+    /**
+     * Applies one easing function to a whole array of alpha values (0.0-1.0)
+     * Evaluates four values at a time with vector kernels; results match ApplyEasing
+     * exactly for Linear and the quadratic curves and to within 1e-6 for the exponential curves
+     *
+     * @param alphas Input values in range 0.0-1.0
+     * @param easingType Type of easing function to apply
+     * @param easedAlphas Eased values in range 0.0-1.0, one per input
+     */
+    UFUNCTION(BlueprintCallable, Category = "AdvBPTools|Math|Interpolation")
+    static void ApplyEasingToArray(const TArray<float>& alphas, EEasingFunction easingType, TArray<float>& easedAlphas);
+
+    /**
+     * Native batch entry point behind ApplyEasingToArray
+     *
+     * @param alphas Input values in range 0.0-1.0
+     * @param easingType Type of easing function to apply
+     * @param easedAlphas Output span, same length as alphas; may be the same memory as alphas
+     */
+    static void ApplyEasingBatch(TConstArrayView<float> alphas, EEasingFunction easingType, TArrayView<float> easedAlphas);
+
+    /**
+     * Applies an easing function with a selectable precision
+     * Table precisions interpolate a shared precomputed table instead of evaluating the curve,
+     * with a worst-case error reported by GetEasingTableMaxError
+     *
+     * @param alpha Input value in range 0.0-1.0
+     * @param easingType Type of easing function to apply
+     * @param precision Exact evaluation or the table size to interpolate
+     * @return Eased value in range 0.0-1.0
+     */
+    UFUNCTION(BlueprintPure, Category = "AdvBPTools|Math|Interpolation")
+    static float ApplyEasingWithPrecision(float alpha, EEasingFunction easingType, EEasingPrecision precision);
+
+    /**
+     * Largest absolute error of an easing table against the exact curve, measured when the table was built
+     *
+     * @param easingType Curve to query
+     * @param precision Table size to query; Exact always reports 0
+     * @return Maximum absolute error over 0.0-1.0
+     */
+    UFUNCTION(BlueprintPure, Category = "AdvBPTools|Math|Interpolation")
+    static float GetEasingTableMaxError(EEasingFunction easingType, EEasingPrecision precision);
+
+    /**
+     * Eases with a curve asset through its shared baked table
+     * The curve's time range maps to alpha 0.0-1.0; values are returned as authored
+     *
+     * @param alpha Input value in range 0.0-1.0
+     * @param curve Curve to ease with; a null curve returns alpha unchanged
+     * @param precision Size of the baked table; Exact uses the largest one
+     * @return Eased value
+     */
+    UFUNCTION(BlueprintPure, Category = "AdvBPTools|Math|Interpolation")
+    static float ApplyEasingCurve(float alpha, UCurveFloat* curve, EEasingPrecision precision = EEasingPrecision::Table256);
+
     /**
      * Applies an easing function to interpolate between two float values
      *
@@ -64,7 +125,33 @@ public:
     UFUNCTION(BlueprintPure, Category = "AdvBPTools|Math|Interpolation")
     static FRotator EaseRotator(FRotator startValue, FRotator endValue, float alpha, EEasingFunction easingType);
 
+    /**
+     * Resolves an easing type to its compiled TEasing kernel, so callers evaluating the same
+     * curve repeatedly pay for the dispatch once instead of on every evaluation
+     *
+     * @param easingType Type of easing function to resolve
+     * @return Kernel taking an alpha already clamped to 0.0-1.0
+     */
+    static FEasingKernel ResolveEasingKernel(EEasingFunction easingType);
+
+    /**
+     * Interpolates between two values with an alpha that was already eased, through a kernel or curve table
+     * Rotators and quaternions take the shortest path through their FMath::Lerp specializations
+     *
+     * @param startValue Starting value
+     * @param endValue Ending value
+     * @param easedAlpha Eased alpha, usually in range 0.0-1.0
+     * @return Interpolated value
+     */
+    template<typename T>
+    static T LerpEasedValue(const T& startValue, const T& endValue, float easedAlpha)
+    {
+        return FMath::Lerp(startValue, endValue, easedAlpha);
+    }
+
 private:
+    template<EEasingFunction> friend struct TEasing;
+
     // Optimized internal implementations of easing functions
 
     /** Linear interpolation (no easing) */
@@ -127,12 +214,50 @@ private:
 
     /**
      * Template function to apply easing between two values of any type that supports lerp
-     * Uses SFINAE to ensure compile-time type safety
      */
     template<typename T>
     static T EaseValue(const T& startValue, const T& endValue, float alpha, EEasingFunction easingType)
     {
-        const float easedAlpha = ApplyEasing(alpha, easingType);
-        return FMath::Lerp(startValue, endValue, easedAlpha);
+        return LerpEasedValue(startValue, endValue, ApplyEasing(alpha, easingType));
+    }
+};
+
+/**
+ * Compile-time specialized easing curve for C++ callers that know the curve up front
+ * Expects alpha already in range 0.0-1.0; no clamping or dispatch happens per call
+ */
+template<EEasingFunction EasingType>
+struct TEasing
+{
+    static FORCEINLINE float Evaluate(float alpha)
+    {
+        if constexpr (EasingType == EEasingFunction::EaseIn)
+        {
+            return UAdvBPUtilities::EaseInQuad(alpha);
+        }
+        else if constexpr (EasingType == EEasingFunction::EaseOut)
+        {
+            return UAdvBPUtilities::EaseOutQuad(alpha);
+        }
+        else if constexpr (EasingType == EEasingFunction::EaseInOut)
+        {
+            return UAdvBPUtilities::EaseInOutQuad(alpha);
+        }
+        else if constexpr (EasingType == EEasingFunction::ExpoIn)
+        {
+            return UAdvBPUtilities::ExponentialIn(alpha);
+        }
+        else if constexpr (EasingType == EEasingFunction::ExpoOut)
+        {
+            return UAdvBPUtilities::ExponentialOut(alpha);
+        }
+        else if constexpr (EasingType == EEasingFunction::ExpoInOut)
+        {
+            return UAdvBPUtilities::ExponentialInOut(alpha);
+        }
+        else
+        {
+            return UAdvBPUtilities::Linear(alpha);
+        }
     }
 };
\ No newline at end of file
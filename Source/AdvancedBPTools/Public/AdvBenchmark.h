@@ -0,0 +1,204 @@
+// Copyright 2025, Wildlight. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AdvBPTypes.h"
+#include "AdvTweenSubsystem.h"
+
+class AActor;
+class UWorld;
+
+/**
+ * Timings of one latent action versus async task comparison, in microseconds per tween
+ */
+struct FAdvLatentVsAsyncResult
+{
+    int32 NumTweens = 0;
+    int32 NumFrames = 0;
+
+    // Cost of starting one tween, including the node's own setup
+    double LatentStartMicros = 0.0;
+    double AsyncStartMicros = 0.0;
+
+    // Cost of advancing one tween by one frame
+    double LatentUpdateMicros = 0.0;
+    double AsyncUpdateMicros = 0.0;
+
+    // Task objects the async path had to allocate because the pool had none idle
+    int32 AsyncTaskAllocations = 0;
+};
+
+/**
+ * Cost of running one kind of async transform tween at scale
+ */
+struct FAdvScaleBenchmarkResult
+{
+    ETweenChannel Channel = ETweenChannel::Location;
+    int32 NumTweens = 0;
+    int32 NumFrames = 0;
+
+    // Cost of starting one tween through its async node, in microseconds
+    double StartMicros = 0.0;
+
+    // Tween subsystem update per frame, in milliseconds
+    double AvgFrameMs = 0.0;
+    double MaxFrameMs = 0.0;
+
+    // Game thread update cost of one tween per frame, in microseconds
+    double UpdateMicrosPerTween = 0.0;
+
+    // Task objects the pool had to allocate and UObjects alive after starting, versus before
+    int32 TaskAllocations = 0;
+    int32 ObjectsCreated = 0;
+
+    // Physical memory used after the run, versus before starting, in kilobytes
+    int64 MemoryDeltaKB = 0;
+
+    // One full garbage collection with every tween still running, in milliseconds
+    double GcMs = 0.0;
+};
+
+/**
+ * Cost of one easing curve through each evaluation path, in nanoseconds per evaluation
+ */
+struct FAdvEasingBenchmarkResult
+{
+    EEasingFunction EasingType = EEasingFunction::Linear;
+
+    // Scalar paths
+    double ApplyEasingNs = 0.0;
+    double KernelNs = 0.0;
+    double EaseFloatNs = 0.0;
+    double EaseVectorNs = 0.0;
+    double EaseRotatorNs = 0.0;
+
+    // ApplyEasingBatch, per value
+    double BatchNs = 0.0;
+};
+
+/**
+ * Precision of one easing curve through each evaluation path against a double precision reference
+ */
+struct FAdvEasingAccuracyResult
+{
+    EEasingFunction EasingType = EEasingFunction::Linear;
+
+    // Largest absolute error over 0.0-1.0
+    double ApplyEasingMaxError = 0.0;
+    double KernelMaxError = 0.0;
+    double BatchMaxError = 0.0;
+
+    // Whether the path returns exactly 0 at alpha 0 and exactly 1 at alpha 1
+    bool bApplyEasingEndpointsExact = false;
+    bool bKernelEndpointsExact = false;
+    bool bBatchEndpointsExact = false;
+
+    // Kernel and batch paths exact at the endpoints and no worse than ApplyEasing beyond float rounding
+    bool bPassed = false;
+};
+
+/**
+ * Runtime benchmarks for the tween paths of the plugin
+ * Benchmarks run synchronously in the given world and drive its latent action manager and tween subsystem
+ * by hand, so they are best run in an otherwise idle map. Results are returned and can be logged.
+ */
+class FAdvBenchmark
+{
+public:
+    /** Largest error a faster easing path may add on top of ApplyEasing, a couple of float ulps around 1.0 */
+    static constexpr double EasingAccuracyTolerance = 1.0e-6;
+
+    /**
+     * Starts the same move on a set of actors once through latent actions and once through the
+     * async move node, then advances each path for a number of frames
+     *
+     * @param world World to spawn the benchmark actors in
+     * @param numTweens Number of actors moved by each path
+     * @param numFrames Number of frames each path is advanced; tweens are long enough to never finish
+     * @return Per-tween timings of both paths
+     */
+    static FAdvLatentVsAsyncResult RunLatentVsAsync(UWorld* world, int32 numTweens, int32 numFrames);
+
+    /** Writes a comparison result as a small table */
+    static void LogResult(const FAdvLatentVsAsyncResult& result, FOutputDevice& ar);
+
+    /**
+     * Starts one async tween per actor through the move, rotate or scale node and advances the world's
+     * tween subsystem for a number of frames, then times a full garbage collection with all of them running
+     *
+     * @param world World to spawn the benchmark actors in
+     * @param channel Which node to run: Location for Move Actor, Rotation for Rotate Actor, Scale for Scale Actor
+     * @param numTweens Number of concurrent tweens
+     * @param numFrames Number of frames to advance; tweens are long enough to never finish
+     * @return Frame, per-tween, allocation and GC figures
+     */
+    static FAdvScaleBenchmarkResult RunScale(UWorld* world, ETweenChannel channel, int32 numTweens, int32 numFrames);
+
+    /**
+     * Runs RunScale for the move, rotate and scale nodes at each tween count, collecting garbage between runs
+     *
+     * @param world World to spawn the benchmark actors in
+     * @param tweenCounts Concurrent tween counts to run; counts of 0 or less are skipped
+     * @param numFrames Number of frames to advance each run
+     * @return Three results per count, in move, rotate, scale order
+     */
+    static TArray<FAdvScaleBenchmarkResult> RunScaleSuite(UWorld* world, TConstArrayView<int32> tweenCounts, int32 numFrames);
+
+    /**
+     * Creates a bare game world with its world subsystems, so benchmarks run without a map or renderer
+     *
+     * @return The world, or nullptr without an engine
+     */
+    static UWorld* CreateBenchmarkWorld();
+
+    /** Tears down a world made by CreateBenchmarkWorld */
+    static void DestroyBenchmarkWorld(UWorld* world);
+
+    /**
+     * Times every easing curve through ApplyEasing, its resolved kernel, EaseFloat, EaseVector, EaseRotator
+     * and ApplyEasingBatch over the same spread of alphas
+     *
+     * @param numEvaluations Evaluations per curve and path
+     * @return One result per EEasingFunction
+     */
+    static TArray<FAdvEasingBenchmarkResult> RunEasing(int32 numEvaluations);
+
+    /** Writes easing timings as a table of nanoseconds per evaluation and millions of evaluations per second */
+    static void LogResult(TConstArrayView<FAdvEasingBenchmarkResult> results, FOutputDevice& ar);
+
+    /**
+     * Compares every easing curve's scalar, kernel and batch paths with the curve evaluated in double precision,
+     * including the endpoint special cases of the exponential curves
+     *
+     * @param numSamples Evenly spaced alphas checked over 0.0-1.0, both endpoints included
+     * @return One result per EEasingFunction
+     */
+    static TArray<FAdvEasingAccuracyResult> CheckEasingAccuracy(int32 numSamples);
+
+    /**
+     * Writes accuracy results as a table
+     *
+     * @return True if every curve passed
+     */
+    static bool LogResult(TConstArrayView<FAdvEasingAccuracyResult> results, FOutputDevice& ar);
+
+    /** Column names matching ToCsvRow */
+    static FString GetScaleCsvHeader();
+
+    /** One comma separated line per result, for comparing plugin versions */
+    static FString ToCsvRow(const FAdvScaleBenchmarkResult& result);
+
+    /** The header followed by one row per result */
+    static TArray<FString> ToCsvRows(TConstArrayView<FAdvScaleBenchmarkResult> results);
+
+    /** Where the scale benchmark CSV goes unless a path is given */
+    static FString GetDefaultScaleCsvPath();
+
+private:
+    // Spawns transient actors with a movable root so transform writes do real work
+    static void SpawnBenchmarkActors(UWorld* world, int32 numActors, TArray<AActor*>& outActors);
+
+    // Destroys actors spawned by SpawnBenchmarkActors
+    static void DestroyBenchmarkActors(TArray<AActor*>& actors);
+};
@@ -0,0 +1,68 @@
+// Copyright 2025, Wildlight. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AdvBPTypes.h"
+
+class UCurveFloat;
+
+/**
+ * Precomputed easing curve sampled at evenly spaced alphas
+ * Evaluation is a clamp, one multiply and a linear interpolation between two neighbouring entries,
+ * trading a bounded error for the transcendental calls of the exponential curves
+ */
+class FAdvEasingTable
+{
+public:
+    /**
+     * Samples a curve over 0.0-1.0 and measures the worst interpolation error against it
+     *
+     * @param curve Reference curve, evaluated only while building
+     * @param numEntries Number of samples, including both endpoints
+     */
+    FAdvEasingTable(TFunctionRef<float(float)> curve, int32 numEntries);
+
+    /**
+     * Returns the shared table for an easing function
+     * Tables are built once, on first use, for every curve and size
+     *
+     * @param easingType Curve to look up
+     * @param precision Table size; must not be Exact
+     */
+    static const FAdvEasingTable& Get(EEasingFunction easingType, EEasingPrecision precision);
+
+    /**
+     * Returns the shared table baked from a float curve asset
+     * The curve's time range maps to alpha 0.0-1.0 and its values are kept as authored, so overshoot survives.
+     * Each curve is baked once per table size; in the editor, a curve whose keys changed is baked again.
+     * Game thread only; the returned table itself may be read from any thread.
+     *
+     * @param curve Curve to bake
+     * @param precision Table size; Exact uses the largest table, rich curves are never evaluated per tween
+     */
+    static TSharedRef<const FAdvEasingTable> GetForCurve(const UCurveFloat& curve, EEasingPrecision precision);
+
+    /** Number of entries for a table precision, 0 for Exact */
+    static int32 GetNumEntries(EEasingPrecision precision);
+
+    /** Interpolates the table at an alpha value, clamped to 0.0-1.0 */
+    FORCEINLINE float Evaluate(float alpha) const
+    {
+        const float Position = FMath::Clamp(alpha, 0.0f, 1.0f) * LastIndex;
+        const int32 Index = FMath::Min(static_cast<int32>(Position), LastIndex - 1);
+        const float Fraction = Position - static_cast<float>(Index);
+
+        return FMath::Lerp(Samples[Index], Samples[Index + 1], Fraction);
+    }
+
+    /** Largest absolute difference from the reference curve found while building */
+    float GetMaxError() const { return MaxError; }
+
+    int32 Num() const { return Samples.Num(); }
+
+private:
+    TArray<float> Samples;
+    int32 LastIndex;
+    float MaxError;
+};
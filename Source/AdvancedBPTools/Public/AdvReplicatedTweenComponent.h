@@ -0,0 +1,148 @@
+// Copyright 2025, Wildlight. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "Engine/NetSerialization.h"
+#include "AdvBPTypes.h"
+#include "AdvTweenSubsystem.h"
+#include "AdvReplicatedTweenComponent.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnReplicatedTweenFinished, bool, bSuccess);
+
+/**
+ * Everything a client needs to play one channel of a server tween by itself
+ */
+USTRUCT()
+struct FAdvReplicatedTween
+{
+    GENERATED_BODY()
+
+    /** Start and target of location and scale tweens */
+    UPROPERTY()
+    FVector_NetQuantize100 StartVector = FVector::ZeroVector;
+
+    UPROPERTY()
+    FVector_NetQuantize100 TargetVector = FVector::ZeroVector;
+
+    /** Start and target of rotation tweens */
+    UPROPERTY()
+    FRotator StartRotation = FRotator::ZeroRotator;
+
+    UPROPERTY()
+    FRotator TargetRotation = FRotator::ZeroRotator;
+
+    UPROPERTY()
+    float Duration = 0.0f;
+
+    /** Server world time the tween started at */
+    UPROPERTY()
+    double ServerStartTime = 0.0;
+
+    UPROPERTY()
+    EEasingFunction EasingType = EEasingFunction::Linear;
+
+    /** False once the server tween was interrupted; clients then leave the actor to movement replication */
+    UPROPERTY()
+    bool bActive = false;
+
+    /** Changes with every start or interruption so clients can tell updates apart; 0 means never started */
+    UPROPERTY()
+    uint8 Sequence = 0;
+};
+
+/**
+ * Replicates transform tweens of its owner once instead of every frame
+ * The server sends start, target, duration, easing and start time; every client evaluates the tween locally
+ * through the tween subsystem with the same easing math. Movement replication of the owner is paused while
+ * tweens run and resumes when the last one ends, reconciling the final transform.
+ */
+UCLASS(ClassGroup = (AdvBPTools), meta = (BlueprintSpawnableComponent))
+class UAdvReplicatedTweenComponent : public UActorComponent
+{
+    GENERATED_BODY()
+
+public:
+    UAdvReplicatedTweenComponent();
+
+    /** Fired on the server and on each client when a tween of this component ends */
+    UPROPERTY(BlueprintAssignable, Category = "AdvBPTools|Replication")
+    FOnReplicatedTweenFinished OnTweenFinished;
+
+    /**
+     * Moves the owner to a location on the server and every client
+     *
+     * @param desiredLocation Target destination
+     * @param duration Time in seconds
+     * @param easingType Interpolation curve type
+     */
+    UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "AdvBPTools|Replication")
+    void ReplicatedMoveTo(FVector desiredLocation, float duration = 1.0f, EEasingFunction easingType = EEasingFunction::Linear);
+
+    /**
+     * Rotates the owner to a rotation on the server and every client, taking the shortest path
+     *
+     * @param desiredRotation Target rotation
+     * @param duration Time in seconds
+     * @param easingType Interpolation curve type
+     */
+    UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "AdvBPTools|Replication")
+    void ReplicatedRotateTo(FRotator desiredRotation, float duration = 1.0f, EEasingFunction easingType = EEasingFunction::Linear);
+
+    /**
+     * Scales the owner to a scale on the server and every client
+     *
+     * @param desiredScale Target scale
+     * @param duration Time in seconds
+     * @param easingType Interpolation curve type
+     */
+    UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "AdvBPTools|Replication")
+    void ReplicatedScaleTo(FVector desiredScale, float duration = 1.0f, EEasingFunction easingType = EEasingFunction::Linear);
+
+    /** Stops every replicated tween of the owner where it is; clients pick up the final transform through movement replication */
+    UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = "AdvBPTools|Replication")
+    void StopReplicatedTweens();
+
+    // UActorComponent interface
+    virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& outLifetimeProps) const override;
+    virtual void EndPlay(const EEndPlayReason::Type endPlayReason) override;
+
+private:
+    // One entry per transform channel, indexed by ETweenChannel
+    UPROPERTY(ReplicatedUsing = OnRep_ReplicatedTweens)
+    FAdvReplicatedTween ReplicatedTweens[3];
+
+    UFUNCTION()
+    void OnRep_ReplicatedTweens();
+
+    // Records a channel on the server and runs it locally
+    void StartServerTween(ETweenChannel channel, const FAdvReplicatedTween& tween);
+
+    // Plays a replicated channel locally, fast-forwarded to the current server time
+    void StartClientTween(ETweenChannel channel);
+
+    // Starts the local tween of a channel from the replicated start value
+    FTweenHandle StartLocalTween(ETweenChannel channel, const FAdvReplicatedTween& tween, int32 sequence);
+
+    // Completion of a local tween; stale sequences belong to tweens that were already replaced
+    void HandleTweenFinished(bool bSuccess, int32 channelIndex, int32 sequence);
+
+    // Server side: clears a channel from the active mask and resumes movement replication once none is left
+    void ReleaseServerChannel(int32 channelIndex);
+
+    // Current server time as seen from this machine
+    double GetServerTime() const;
+
+    static uint8 NextSequence(uint8 sequence) { return sequence == MAX_uint8 ? 1 : sequence + 1; }
+
+    // Local tweens playing the replicated channels
+    FTweenHandle LocalHandles[3];
+
+    // Last sequence of each channel this client has acted on
+    uint8 AppliedSequences[3] = { 0, 0, 0 };
+
+    // Server side bookkeeping for pausing and restoring movement replication
+    uint8 ActiveChannelMask = 0;
+    bool bRestoreReplicateMovement = false;
+};
@@ -0,0 +1,29 @@
+// Copyright 2025, Wildlight. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "AdvScaleBenchmarkCommandlet.generated.h"
+
+/**
+ * Headless scale benchmark for the async transform tweens
+ * Creates a bare game world and runs FAdvBenchmark::RunScale for the move, rotate and scale nodes at each
+ * requested tween count, writing one CSV row per run. Needs no renderer, so it runs with -nullrhi on a build box:
+ *
+ *   UnrealEditor-Cmd <Project> -run=AdvScaleBenchmark -nullrhi -unattended [-Counts=1000,10000,100000] [-Frames=120] [-Output=<file.csv>]
+ *
+ * The same runs and CSV are available as the AdvBPTools.Benchmark.Scale automation test.
+ * With -Easing it instead runs the easing microbenchmarks and accuracy checks, returning 1 if any easing path regressed.
+ */
+UCLASS()
+class UAdvScaleBenchmarkCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UAdvScaleBenchmarkCommandlet();
+
+    // UCommandlet interface
+    virtual int32 Main(const FString& params) override;
+};
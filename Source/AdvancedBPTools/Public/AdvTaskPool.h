@@ -0,0 +1,120 @@
+// Copyright 2025, Wildlight. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Kismet/BlueprintAsyncActionBase.h"
+#include "AdvTaskPool.generated.h"
+
+/**
+ * Counters describing how well the async task pool is recycling instances
+ */
+USTRUCT(BlueprintType)
+struct FAdvTaskPoolStats
+{
+    GENERATED_BODY()
+
+    /** Task requests served from the pool */
+    UPROPERTY(BlueprintReadOnly, Category = "AdvBPTools|Pool")
+    int32 Hits = 0;
+
+    /** Task requests that had to allocate a new object */
+    UPROPERTY(BlueprintReadOnly, Category = "AdvBPTools|Pool")
+    int32 Misses = 0;
+
+    /** Completed tasks handed back for reuse */
+    UPROPERTY(BlueprintReadOnly, Category = "AdvBPTools|Pool")
+    int32 Releases = 0;
+
+    /** Completed tasks left to the garbage collector because their pool was full */
+    UPROPERTY(BlueprintReadOnly, Category = "AdvBPTools|Pool")
+    int32 Discards = 0;
+
+    /** Instances currently idle in the pool */
+    UPROPERTY(BlueprintReadOnly, Category = "AdvBPTools|Pool")
+    int32 Idle = 0;
+
+    /** Hits divided by all requests, 0 if nothing was requested yet */
+    UPROPERTY(BlueprintReadOnly, Category = "AdvBPTools|Pool")
+    float HitRate = 0.0f;
+};
+
+/**
+ * Idle instances of one task class
+ */
+USTRUCT()
+struct FAdvTaskPoolBucket
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    TArray<TObjectPtr<UBlueprintAsyncActionBase>> IdleTasks;
+};
+
+/**
+ * Per-world pool recycling async task objects after they complete,
+ * so frequently fired nodes stop allocating a UObject per call and leaving it to the garbage collector
+ */
+UCLASS()
+class UAdvTaskPoolSubsystem : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Finds the task pool for the world of a context object
+     *
+     * @param worldContextObject Any object living in the target world
+     * @return The pool, or nullptr if the world has none
+     */
+    static UAdvTaskPoolSubsystem* Get(const UObject* worldContextObject);
+
+    /**
+     * Returns a ready-to-initialize task, reused from the pool when one is idle
+     * Falls back to a plain NewObject when the context has no world
+     *
+     * @param worldContextObject Any object living in the world the task will run in
+     */
+    template<typename TaskType>
+    static TaskType* AcquireTask(const UObject* worldContextObject)
+    {
+        UAdvTaskPoolSubsystem* TaskPool = Get(worldContextObject);
+        return TaskPool ? CastChecked<TaskType>(TaskPool->Acquire(TaskType::StaticClass())) : NewObject<TaskType>();
+    }
+
+    /**
+     * Hands a finished task back for reuse
+     * The task must have cleared its delegates and target references and called SetReadyToDestroy
+     *
+     * @param task Task that will not broadcast again
+     */
+    void Release(UBlueprintAsyncActionBase* task);
+
+    /** Current pool counters */
+    FAdvTaskPoolStats GetStats() const;
+
+    /**
+     * Reports how many async task requests were served from the pool in this world
+     *
+     * @param worldContextObject Any object living in the world to query
+     * @return Pool counters and hit rate
+     */
+    UFUNCTION(BlueprintPure, meta = (WorldContext = "worldContextObject"), Category = "AdvBPTools|Debug")
+    static FAdvTaskPoolStats GetTaskPoolStats(const UObject* worldContextObject);
+
+    // USubsystem interface
+    virtual void Deinitialize() override;
+
+private:
+    // Pops an idle instance of a class or creates one outered to this pool
+    UBlueprintAsyncActionBase* Acquire(UClass* taskClass);
+
+    UPROPERTY()
+    TMap<TObjectPtr<UClass>, FAdvTaskPoolBucket> Buckets;
+
+    int32 Hits = 0;
+    int32 Misses = 0;
+    int32 Releases = 0;
+    int32 Discards = 0;
+};
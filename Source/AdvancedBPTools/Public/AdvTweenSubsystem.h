@@ -0,0 +1,1373 @@
+// Copyright 2025, Wildlight. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tasks/Task.h"
+#include "UObject/ObjectKey.h"
+#include "AdvBPTypes.h"
+#include "AdvBPUtility.h"
+#include "AdvTweenSubsystem.generated.h"
+
+class UInstancedStaticMeshComponent;
+class UMaterialParameterCollection;
+class UPrimitiveComponent;
+class USceneComponent;
+class USplineComponent;
+class UCurveFloat;
+class FAdvEasingTable;
+
+/** Fired once when a tween finishes; bSuccess is false if the target went away, the last write failed or the tween was cancelled */
+DECLARE_DELEGATE_OneParam(FOnAdvTweenFinished, bool /*bSuccess*/);
+
+/**
+ * One key of a keyframe track tween
+ */
+USTRUCT(BlueprintType)
+struct FAdvTransformKey
+{
+    GENERATED_BODY()
+
+    /** Seconds from the start of the track */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AdvBPTools|Keyframes")
+    float Time = 0.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AdvBPTools|Keyframes")
+    FVector Location = FVector::ZeroVector;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AdvBPTools|Keyframes")
+    FRotator Rotation = FRotator::ZeroRotator;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AdvBPTools|Keyframes")
+    FVector Scale = FVector::OneVector;
+
+    /** Curve of the segment leading into this key */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AdvBPTools|Keyframes")
+    EEasingFunction EasingType = EEasingFunction::Linear;
+};
+
+/**
+ * One step of a tween sequence
+ */
+USTRUCT(BlueprintType)
+struct FAdvTweenStep
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AdvBPTools|Sequence")
+    ETweenStepType StepType = ETweenStepType::Move;
+
+    /** Target location of Move steps, target scale of Scale steps */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AdvBPTools|Sequence")
+    FVector Vector = FVector::ZeroVector;
+
+    /** Target rotation of Rotate steps */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AdvBPTools|Sequence")
+    FRotator Rotation = FRotator::ZeroRotator;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AdvBPTools|Sequence")
+    float Duration = 1.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AdvBPTools|Sequence")
+    EEasingFunction EasingType = EEasingFunction::Linear;
+
+    /** Targets are offsets from where the step starts: added for Move, applied on top for Rotate, multiplied for Scale */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AdvBPTools|Sequence")
+    bool bRelative = false;
+
+    /** Starts together with the previous step instead of after it; parallel steps should drive different channels */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AdvBPTools|Sequence")
+    bool bWithPrevious = false;
+};
+
+/**
+ * Update rate a tween runs at under AdvBPTools.Tween.LOD.Enable
+ */
+enum class ETweenLodLevel : uint8
+{
+    // Evaluated and written every update
+    Full,
+    // Evaluated every AdvBPTools.Tween.LOD.ReducedInterval updates
+    Reduced,
+    // Only written when it completes
+    CompletionOnly
+};
+
+/** Decides the LOD level of a tweened actor or instanced component, replacing the built-in distance and visibility heuristic */
+DECLARE_DELEGATE_RetVal_OneParam(ETweenLodLevel, FOnAdvTweenLod, const UObject* /*target*/);
+
+/**
+ * Transform channel driven by a tween
+ */
+enum class ETweenChannel : uint8
+{
+    Location,
+    Rotation,
+    Scale
+};
+
+/**
+ * Type of a UPROPERTY driven by a property tween
+ */
+enum class ETweenPropertyType : uint8
+{
+    Float,
+    Double,
+    Vector,
+    Rotator,
+    LinearColor
+};
+
+/**
+ * Maps the value types property tweens accept to their property type, and packs them into four doubles
+ * Float and double values tween float and double properties alike
+ */
+template<typename T>
+struct TAdvTweenPropertyTraits;
+
+template<>
+struct TAdvTweenPropertyTraits<float>
+{
+    static constexpr ETweenPropertyType Type = ETweenPropertyType::Float;
+    static FVector4d Pack(float value) { return FVector4d(value, 0.0, 0.0, 0.0); }
+    static float Unpack(const FVector4d& value) { return static_cast<float>(value.X); }
+};
+
+template<>
+struct TAdvTweenPropertyTraits<double>
+{
+    static constexpr ETweenPropertyType Type = ETweenPropertyType::Double;
+    static FVector4d Pack(double value) { return FVector4d(value, 0.0, 0.0, 0.0); }
+    static double Unpack(const FVector4d& value) { return value.X; }
+};
+
+template<>
+struct TAdvTweenPropertyTraits<FVector>
+{
+    static constexpr ETweenPropertyType Type = ETweenPropertyType::Vector;
+    static FVector4d Pack(const FVector& value) { return FVector4d(value.X, value.Y, value.Z, 0.0); }
+    static FVector Unpack(const FVector4d& value) { return FVector(value.X, value.Y, value.Z); }
+};
+
+template<>
+struct TAdvTweenPropertyTraits<FRotator>
+{
+    static constexpr ETweenPropertyType Type = ETweenPropertyType::Rotator;
+    static FVector4d Pack(const FRotator& value) { return FVector4d(value.Pitch, value.Yaw, value.Roll, 0.0); }
+    static FRotator Unpack(const FVector4d& value) { return FRotator(value.X, value.Y, value.Z); }
+};
+
+template<>
+struct TAdvTweenPropertyTraits<FLinearColor>
+{
+    static constexpr ETweenPropertyType Type = ETweenPropertyType::LinearColor;
+    static FVector4d Pack(const FLinearColor& value) { return FVector4d(value.R, value.G, value.B, value.A); }
+    static FLinearColor Unpack(const FVector4d& value) { return FLinearColor(value.X, value.Y, value.Z, value.W); }
+};
+
+/**
+ * Per-tween options packed into one byte of storage
+ */
+enum class ETweenFlags : uint8
+{
+    None = 0,
+    Sweep = 1 << 0,
+    ShortestPath = 1 << 1,
+    VelocityTiming = 1 << 2,
+    Additive = 1 << 3,
+    OrientToPath = 1 << 4,
+    DeferMovement = 1 << 5
+};
+ENUM_CLASS_FLAGS(ETweenFlags);
+
+/**
+ * Lightweight reference to a tween owned by UAdvTweenSubsystem
+ * The generation makes handles to finished tweens go stale instead of aliasing whatever reuses their slot
+ */
+struct FTweenHandle
+{
+    int32 Index = INDEX_NONE;
+    uint32 Generation = 0;
+
+    /** True if the handle was ever assigned; use UAdvTweenSubsystem::IsTweenActive to check the tween is still running */
+    bool IsSet() const { return Index != INDEX_NONE; }
+
+    void Reset() { *this = FTweenHandle(); }
+
+    bool operator==(const FTweenHandle& other) const { return Index == other.Index && Generation == other.Generation; }
+    bool operator!=(const FTweenHandle& other) const { return !(*this == other); }
+};
+
+/**
+ * Blueprint copy of an FTweenHandle, handed out by the async transform nodes
+ * Goes stale with its tween, so calls made with it after the tween finished are rejected
+ */
+USTRUCT(BlueprintType)
+struct FAdvTweenHandle
+{
+    GENERATED_BODY()
+
+    FAdvTweenHandle() = default;
+    explicit FAdvTweenHandle(const FTweenHandle& handle) : Handle(handle) {}
+
+    FTweenHandle Handle;
+};
+
+/**
+ * Lightweight reference to a tween sequence owned by UAdvTweenSubsystem, goes stale when the sequence ends
+ */
+struct FTweenSequenceHandle
+{
+    int32 Index = INDEX_NONE;
+    uint32 Generation = 0;
+
+    bool IsSet() const { return Index != INDEX_NONE; }
+
+    void Reset() { *this = FTweenSequenceHandle(); }
+};
+
+/**
+ * Per-world tween engine
+ * Owns every active transform tween in struct-of-arrays storage and advances them in one pass per frame.
+ * All channels driven on one actor are gathered into a single transform write per frame, and a
+ * conflict policy decides what happens when a second tween targets a channel that is already driven.
+ * Tweens deferring movement (AdvBPTools.Tween.DeferMovementUpdates, SetTweenDeferMovementUpdates) keep their targets in a
+ * deferred FScopedMovementUpdate across the whole flush; sweeping writes stay immediate unless AdvBPTools.Tween.DeferSweptMovement is set.
+ * Tweens advance once per frame by the frame time, or on a fixed step grid (AdvBPTools.Tween.UpdateMode).
+ * With AdvBPTools.Tween.LOD.Enable, tweens on far away or hidden targets update at reduced rates or only on completion.
+ * Instances of an instanced static mesh component can be tweened too; all instances of one component
+ * go out as contiguous batch updates followed by a single render state dirty per frame.
+ * Scene components can be tweened in relative space through their own write record, leaving the rest of the actor alone.
+ * Float, double, FVector, FRotator and FLinearColor UPROPERTYs of any object can be tweened by name; the property
+ * is resolved once when the tween starts and every update is a typed write straight into the object.
+ * Material parameters are tweened through custom primitive data or a material parameter collection, batched per
+ * component or collection per frame, so fading hundreds of props creates no material instances.
+ * Sequences chain steps and parallel groups inside the subsystem, each group starting in the update the previous one ended.
+ * C++ callers drive tweens through FTweenHandle; the Blueprint async nodes are thin wrappers over the same API.
+ * Storage is preallocated (AdvBPTools.Tween.InitialCapacity), so starting a tween without a completion
+ * delegate performs no heap allocation until that capacity is exceeded.
+ */
+UCLASS()
+class UAdvTweenSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Finds the tween subsystem for the world of a context object
+     *
+     * @param worldContextObject Any object living in the target world
+     * @return The subsystem, or nullptr if the world has none
+     */
+    static UAdvTweenSubsystem* Get(const UObject* worldContextObject);
+
+    /**
+     * Moves an actor from its current location to a target location
+     *
+     * @param targetActor Actor to move
+     * @param desiredLocation Target destination
+     * @param time Time in seconds or units per second (depending on timingMode)
+     * @param timingMode Whether to use duration or velocity for timing
+     * @param easingType Interpolation curve type
+     * @param bSweep Whether to sweep for collisions during movement
+     * @param threadingType Where the interpolation math runs; transforms are always written on the game thread
+     * @param conflictPolicy What to do with tweens already driving the same channel of the actor
+     * @param onFinished Called once when the tween completes, fails or is cancelled
+     * @return Handle to the running or queued tween, unset if the actor is invalid
+     */
+    FTweenHandle StartLocationTween(
+        AActor* targetActor,
+        const FVector& desiredLocation,
+        float time,
+        EMoveTimingMode timingMode = EMoveTimingMode::Duration,
+        EEasingFunction easingType = EEasingFunction::Linear,
+        bool bSweep = false,
+        EThreadingType threadingType = EThreadingType::GameThread,
+        ETweenConflictPolicy conflictPolicy = ETweenConflictPolicy::Replace,
+        FOnAdvTweenFinished&& onFinished = FOnAdvTweenFinished());
+
+    /**
+     * Rotates an actor from its current rotation to a target rotation with quaternion Slerp
+     *
+     * @param targetActor Actor to rotate
+     * @param desiredRotation Target rotation
+     * @param time Time in seconds or degrees per second (depending on timingMode)
+     * @param timingMode Whether to use duration or angular velocity for timing
+     * @param easingType Interpolation curve type
+     * @param bShortestPath Whether to take the shortest path for rotation
+     * @param threadingType Where the interpolation math runs; transforms are always written on the game thread
+     * @param conflictPolicy What to do with tweens already driving the same channel of the actor
+     * @param onFinished Called once when the tween completes, fails or is cancelled
+     * @return Handle to the running or queued tween, unset if the actor is invalid
+     */
+    FTweenHandle StartRotationTween(
+        AActor* targetActor,
+        const FRotator& desiredRotation,
+        float time,
+        EMoveTimingMode timingMode = EMoveTimingMode::Duration,
+        EEasingFunction easingType = EEasingFunction::Linear,
+        bool bShortestPath = true,
+        EThreadingType threadingType = EThreadingType::GameThread,
+        ETweenConflictPolicy conflictPolicy = ETweenConflictPolicy::Replace,
+        FOnAdvTweenFinished&& onFinished = FOnAdvTweenFinished());
+
+    /**
+     * Scales an actor from its current scale to a target scale
+     *
+     * @param targetActor Actor to scale
+     * @param desiredScale Target scale
+     * @param duration Time in seconds
+     * @param easingType Interpolation curve type
+     * @param threadingType Where the interpolation math runs; transforms are always written on the game thread
+     * @param conflictPolicy What to do with tweens already driving the same channel of the actor
+     * @param onFinished Called once when the tween completes, fails or is cancelled
+     * @return Handle to the running or queued tween, unset if the actor is invalid
+     */
+    FTweenHandle StartScaleTween(
+        AActor* targetActor,
+        const FVector& desiredScale,
+        float duration,
+        EEasingFunction easingType = EEasingFunction::Linear,
+        EThreadingType threadingType = EThreadingType::GameThread,
+        ETweenConflictPolicy conflictPolicy = ETweenConflictPolicy::Replace,
+        FOnAdvTweenFinished&& onFinished = FOnAdvTweenFinished());
+
+    /**
+     * Moves a scene component to a location relative to its parent
+     * Component tweens write the relative transform, so only the component's own subtree is updated and the
+     * owning actor stays where it is. They share conflict policies, queues and LOD with actor tweens, per component.
+     *
+     * @param targetComponent Component to move
+     * @param desiredLocation Target destination relative to the component's parent
+     * @param time Time in seconds or units per second (depending on timingMode)
+     * @param timingMode Whether to use duration or velocity for timing
+     * @param easingType Interpolation curve type
+     * @param bSweep Whether to sweep for collisions during movement; the tween fails if its last sweep could not move the actor at all
+     * @param threadingType Where the interpolation math runs; transforms are always written on the game thread
+     * @param conflictPolicy What to do with tweens already driving the same channel of the component
+     * @param onFinished Called once when the tween completes, fails or is cancelled
+     * @return Handle to the running or queued tween, unset if the component is invalid
+     */
+    FTweenHandle StartComponentLocationTween(
+        USceneComponent* targetComponent,
+        const FVector& desiredLocation,
+        float time,
+        EMoveTimingMode timingMode = EMoveTimingMode::Duration,
+        EEasingFunction easingType = EEasingFunction::Linear,
+        bool bSweep = false,
+        EThreadingType threadingType = EThreadingType::GameThread,
+        ETweenConflictPolicy conflictPolicy = ETweenConflictPolicy::Replace,
+        FOnAdvTweenFinished&& onFinished = FOnAdvTweenFinished());
+
+    /**
+     * Rotates a scene component to a rotation relative to its parent
+     *
+     * @param targetComponent Component to rotate
+     * @param desiredRotation Target rotation relative to the component's parent
+     * @param time Time in seconds or degrees per second (depending on timingMode)
+     * @param timingMode Whether to use duration or angular velocity for timing
+     * @param easingType Interpolation curve type
+     * @param bShortestPath Whether to take the shortest path for rotation
+     * @param threadingType Where the interpolation math runs; transforms are always written on the game thread
+     * @param conflictPolicy What to do with tweens already driving the same channel of the component
+     * @param onFinished Called once when the tween completes, fails or is cancelled
+     * @return Handle to the running or queued tween, unset if the component is invalid
+     */
+    FTweenHandle StartComponentRotationTween(
+        USceneComponent* targetComponent,
+        const FRotator& desiredRotation,
+        float time,
+        EMoveTimingMode timingMode = EMoveTimingMode::Duration,
+        EEasingFunction easingType = EEasingFunction::Linear,
+        bool bShortestPath = true,
+        EThreadingType threadingType = EThreadingType::GameThread,
+        ETweenConflictPolicy conflictPolicy = ETweenConflictPolicy::Replace,
+        FOnAdvTweenFinished&& onFinished = FOnAdvTweenFinished());
+
+    /**
+     * Scales a scene component to a scale relative to its parent
+     *
+     * @param targetComponent Component to scale
+     * @param desiredScale Target relative scale
+     * @param duration Time in seconds
+     * @param easingType Interpolation curve type
+     * @param threadingType Where the interpolation math runs; transforms are always written on the game thread
+     * @param conflictPolicy What to do with tweens already driving the same channel of the component
+     * @param onFinished Called once when the tween completes, fails or is cancelled
+     * @return Handle to the running or queued tween, unset if the component is invalid
+     */
+    FTweenHandle StartComponentScaleTween(
+        USceneComponent* targetComponent,
+        const FVector& desiredScale,
+        float duration,
+        EEasingFunction easingType = EEasingFunction::Linear,
+        EThreadingType threadingType = EThreadingType::GameThread,
+        ETweenConflictPolicy conflictPolicy = ETweenConflictPolicy::Replace,
+        FOnAdvTweenFinished&& onFinished = FOnAdvTweenFinished());
+
+    /**
+     * Moves an actor along a spline at constant speed, with easing applied to the distance travelled
+     * The spline's arc length is sampled into a table once and shared by every tween on that spline, so each
+     * update is a table lookup. The table is rebuilt when the spline is edited and follows the spline component
+     * when it moves. Additive conflict policy is treated as Replace.
+     *
+     * @param targetActor Actor to move
+     * @param spline Path to follow
+     * @param time Time in seconds or units per second along the spline (depending on timingMode)
+     * @param timingMode Whether to use duration or velocity for timing
+     * @param easingType Interpolation curve applied to the distance along the spline
+     * @param bOrientToSpline Whether to also rotate the actor to the spline's direction
+     * @param bReverse Whether to travel from the end of the spline to its start
+     * @param threadingType Where the interpolation math runs; transforms are always written on the game thread
+     * @param conflictPolicy What to do with tweens already driving the location of the actor
+     * @param onFinished Called once when the tween completes, fails or is cancelled
+     * @return Handle to the running or queued tween, unset if the actor or spline is invalid
+     */
+    FTweenHandle StartSplineTween(
+        AActor* targetActor,
+        USplineComponent* spline,
+        float time,
+        EMoveTimingMode timingMode = EMoveTimingMode::Duration,
+        EEasingFunction easingType = EEasingFunction::Linear,
+        bool bOrientToSpline = false,
+        bool bReverse = false,
+        EThreadingType threadingType = EThreadingType::GameThread,
+        ETweenConflictPolicy conflictPolicy = ETweenConflictPolicy::Replace,
+        FOnAdvTweenFinished&& onFinished = FOnAdvTweenFinished());
+
+    /**
+     * Plays a keyframe track on an actor as a single tween
+     * Keys are world-space transforms sorted by time; each segment uses the easing of the key it leads into.
+     * If the first key is after zero, the track starts from the actor's transform when the tween begins.
+     * A cursor remembers the current segment, so each update only looks at the next key.
+     * The tween owns the first driven channel for conflict purposes and also writes the others; Additive is treated as Replace.
+     *
+     * @param targetActor Actor to animate
+     * @param keys Keys of the track, in any order
+     * @param bDriveLocation Whether the track writes the location of the actor
+     * @param bDriveRotation Whether the track writes the rotation of the actor
+     * @param bDriveScale Whether the track writes the scale of the actor
+     * @param bSweep Whether to sweep for collisions during movement
+     * @param threadingType Where the interpolation math runs; transforms are always written on the game thread
+     * @param conflictPolicy What to do with tweens already driving the first driven channel of the actor
+     * @param onFinished Called once when the tween completes, fails or is cancelled
+     * @return Handle to the running or queued tween, unset if the actor is invalid, there are no keys or no channel is driven
+     */
+    FTweenHandle StartKeyframeTween(
+        AActor* targetActor,
+        TConstArrayView<FAdvTransformKey> keys,
+        bool bDriveLocation = true,
+        bool bDriveRotation = false,
+        bool bDriveScale = false,
+        bool bSweep = false,
+        EThreadingType threadingType = EThreadingType::GameThread,
+        ETweenConflictPolicy conflictPolicy = ETweenConflictPolicy::Replace,
+        FOnAdvTweenFinished&& onFinished = FOnAdvTweenFinished());
+
+    /**
+     * Moves one instance of an instanced static mesh component to a world-space location
+     * A new tween on an instance channel that is already tweened replaces the previous one.
+     * Instance indices are not tracked through removals; removing instances below a tweened one retargets it.
+     *
+     * @param component Component owning the instance
+     * @param instanceIndex Index of the instance to move
+     * @param desiredLocation Target destination in world space
+     * @param time Time in seconds or units per second (depending on timingMode)
+     * @param timingMode Whether to use duration or velocity for timing
+     * @param easingType Interpolation curve type
+     * @param threadingType Where the interpolation math runs; instances are always updated on the game thread
+     * @param onFinished Called once when the tween completes, fails or is cancelled
+     * @return Handle to the running tween, unset if the component or instance is invalid
+     */
+    FTweenHandle StartInstanceLocationTween(
+        UInstancedStaticMeshComponent* component,
+        int32 instanceIndex,
+        const FVector& desiredLocation,
+        float time,
+        EMoveTimingMode timingMode = EMoveTimingMode::Duration,
+        EEasingFunction easingType = EEasingFunction::Linear,
+        EThreadingType threadingType = EThreadingType::GameThread,
+        FOnAdvTweenFinished&& onFinished = FOnAdvTweenFinished());
+
+    /**
+     * Rotates one instance of an instanced static mesh component to a world-space rotation
+     *
+     * @param component Component owning the instance
+     * @param instanceIndex Index of the instance to rotate
+     * @param desiredRotation Target rotation in world space
+     * @param time Time in seconds or degrees per second (depending on timingMode)
+     * @param timingMode Whether to use duration or angular velocity for timing
+     * @param easingType Interpolation curve type
+     * @param bShortestPath Whether to take the shortest path for rotation
+     * @param threadingType Where the interpolation math runs; instances are always updated on the game thread
+     * @param onFinished Called once when the tween completes, fails or is cancelled
+     * @return Handle to the running tween, unset if the component or instance is invalid
+     */
+    FTweenHandle StartInstanceRotationTween(
+        UInstancedStaticMeshComponent* component,
+        int32 instanceIndex,
+        const FRotator& desiredRotation,
+        float time,
+        EMoveTimingMode timingMode = EMoveTimingMode::Duration,
+        EEasingFunction easingType = EEasingFunction::Linear,
+        bool bShortestPath = true,
+        EThreadingType threadingType = EThreadingType::GameThread,
+        FOnAdvTweenFinished&& onFinished = FOnAdvTweenFinished());
+
+    /**
+     * Scales one instance of an instanced static mesh component to a world-space scale
+     *
+     * @param component Component owning the instance
+     * @param instanceIndex Index of the instance to scale
+     * @param desiredScale Target scale
+     * @param duration Time in seconds
+     * @param easingType Interpolation curve type
+     * @param threadingType Where the interpolation math runs; instances are always updated on the game thread
+     * @param onFinished Called once when the tween completes, fails or is cancelled
+     * @return Handle to the running tween, unset if the component or instance is invalid
+     */
+    FTweenHandle StartInstanceScaleTween(
+        UInstancedStaticMeshComponent* component,
+        int32 instanceIndex,
+        const FVector& desiredScale,
+        float duration,
+        EEasingFunction easingType = EEasingFunction::Linear,
+        EThreadingType threadingType = EThreadingType::GameThread,
+        FOnAdvTweenFinished&& onFinished = FOnAdvTweenFinished());
+
+    /**
+     * Tweens one float of a primitive component's custom primitive data
+     * Materials read it through a Custom Primitive Data node, so no dynamic material instance is needed.
+     * All floats tweened on one component are written together once per frame. A new tween on a data index
+     * that is already tweened replaces the previous one, including color tweens covering that index.
+     *
+     * @param component Component whose custom primitive data to change
+     * @param dataIndex Index of the float to tween
+     * @param desiredValue Value to arrive at
+     * @param duration Time in seconds
+     * @param easingType Interpolation curve type
+     * @param threadingType Where the interpolation math runs; data is always written on the game thread
+     * @param onFinished Called once when the tween completes, fails or is cancelled
+     * @return Handle to the running tween, unset if the component is invalid or the index is out of range
+     */
+    FTweenHandle StartPrimitiveDataScalarTween(
+        UPrimitiveComponent* component,
+        int32 dataIndex,
+        float desiredValue,
+        float duration,
+        EEasingFunction easingType = EEasingFunction::Linear,
+        EThreadingType threadingType = EThreadingType::GameThread,
+        FOnAdvTweenFinished&& onFinished = FOnAdvTweenFinished());
+
+    /**
+     * Tweens four consecutive floats of a primitive component's custom primitive data as a color
+     * Replaces every tween on any of the four floats, scalar or color.
+     *
+     * @param component Component whose custom primitive data to change
+     * @param dataIndex Index of the first of the four floats, which hold R, G, B and A
+     * @param desiredValue Value to arrive at
+     * @param duration Time in seconds
+     * @param easingType Interpolation curve type
+     * @param threadingType Where the interpolation math runs; data is always written on the game thread
+     * @param onFinished Called once when the tween completes, fails or is cancelled
+     * @return Handle to the running tween, unset if the component is invalid or the floats are out of range
+     */
+    FTweenHandle StartPrimitiveDataVectorTween(
+        UPrimitiveComponent* component,
+        int32 dataIndex,
+        const FLinearColor& desiredValue,
+        float duration,
+        EEasingFunction easingType = EEasingFunction::Linear,
+        EThreadingType threadingType = EThreadingType::GameThread,
+        FOnAdvTweenFinished&& onFinished = FOnAdvTweenFinished());
+
+    /**
+     * Tweens a scalar parameter of a material parameter collection in this world
+     * Every material using the collection follows it, from a single parameter write per frame.
+     *
+     * @param collection Collection owning the parameter
+     * @param parameterName Name of the scalar parameter
+     * @param desiredValue Value to arrive at
+     * @param duration Time in seconds
+     * @param easingType Interpolation curve type
+     * @param threadingType Where the interpolation math runs; parameters are always written on the game thread
+     * @param onFinished Called once when the tween completes, fails or is cancelled
+     * @return Handle to the running tween, unset if the collection has no such parameter
+     */
+    FTweenHandle StartCollectionScalarTween(
+        UMaterialParameterCollection* collection,
+        FName parameterName,
+        float desiredValue,
+        float duration,
+        EEasingFunction easingType = EEasingFunction::Linear,
+        EThreadingType threadingType = EThreadingType::GameThread,
+        FOnAdvTweenFinished&& onFinished = FOnAdvTweenFinished());
+
+    /**
+     * Tweens a vector parameter of a material parameter collection in this world
+     *
+     * @param collection Collection owning the parameter
+     * @param parameterName Name of the vector parameter
+     * @param desiredValue Value to arrive at
+     * @param duration Time in seconds
+     * @param easingType Interpolation curve type
+     * @param threadingType Where the interpolation math runs; parameters are always written on the game thread
+     * @param onFinished Called once when the tween completes, fails or is cancelled
+     * @return Handle to the running tween, unset if the collection has no such parameter
+     */
+    FTweenHandle StartCollectionVectorTween(
+        UMaterialParameterCollection* collection,
+        FName parameterName,
+        const FLinearColor& desiredValue,
+        float duration,
+        EEasingFunction easingType = EEasingFunction::Linear,
+        EThreadingType threadingType = EThreadingType::GameThread,
+        FOnAdvTweenFinished&& onFinished = FOnAdvTweenFinished());
+
+    /**
+     * Tweens a float, double, FVector, FRotator or FLinearColor UPROPERTY of an object by name
+     * The property is looked up once here; updates write the value straight to its offset in the object, so
+     * setters, OnRep functions and property change notifications are not called. Rotators take the shortest path.
+     * A new tween on a property of an object that is already tweened replaces the previous one.
+     *
+     * @param target Object owning the property
+     * @param propertyName Name of the property; float and double values drive float and double properties alike
+     * @param desiredValue Value to arrive at
+     * @param duration Time in seconds
+     * @param easingType Interpolation curve type
+     * @param threadingType Where the interpolation math runs; properties are always written on the game thread
+     * @param onFinished Called once when the tween completes, fails or is cancelled
+     * @return Handle to the running tween, unset if the object has no such property of a matching type
+     */
+    template<typename T>
+    FTweenHandle StartPropertyTween(
+        UObject* target,
+        FName propertyName,
+        const T& desiredValue,
+        float duration,
+        EEasingFunction easingType = EEasingFunction::Linear,
+        EThreadingType threadingType = EThreadingType::GameThread,
+        FOnAdvTweenFinished&& onFinished = FOnAdvTweenFinished())
+    {
+        return StartPropertyTweenPacked(
+            target, propertyName, TAdvTweenPropertyTraits<T>::Type, TAdvTweenPropertyTraits<T>::Pack(desiredValue),
+            duration, easingType, threadingType, MoveTemp(onFinished));
+    }
+
+    /**
+     * Tweens the same property to the same value on many objects
+     * The property is resolved once per class rather than once per object. Completion is tracked through the handles.
+     *
+     * @param targets Objects owning the property
+     * @param propertyName Name of the property
+     * @param desiredValue Value to arrive at
+     * @param duration Time in seconds
+     * @param easingType Interpolation curve type
+     * @param threadingType Where the interpolation math runs; properties are always written on the game thread
+     * @return One handle per target, unset for targets without a matching property
+     */
+    template<typename T>
+    TArray<FTweenHandle> StartPropertyTweens(
+        TConstArrayView<UObject*> targets,
+        FName propertyName,
+        const T& desiredValue,
+        float duration,
+        EEasingFunction easingType = EEasingFunction::Linear,
+        EThreadingType threadingType = EThreadingType::GameThread)
+    {
+        return StartPropertyTweensPacked(
+            targets, propertyName, TAdvTweenPropertyTraits<T>::Type, TAdvTweenPropertyTraits<T>::Pack(desiredValue),
+            duration, easingType, threadingType);
+    }
+
+    /** Stops advancing a running tween, leaving the target where it is; returns false for stale or queued handles */
+    bool PauseTween(FTweenHandle handle);
+
+    /** Continues a paused tween from where it stopped; returns false for stale handles */
+    bool ResumeTween(FTweenHandle handle);
+
+    /** Stops a tween for good and fires its completion delegate with bSuccess false; returns false for stale handles */
+    bool CancelTween(FTweenHandle handle);
+
+    /** True while the tween is running, paused or queued */
+    bool IsTweenActive(FTweenHandle handle) const;
+
+    /** True if the tween is active and paused */
+    bool IsTweenPaused(FTweenHandle handle) const;
+
+    /** Linear progress from 0.0 to 1.0 before easing, or -1.0 for stale handles and cancelled tweens */
+    float GetTweenProgress(FTweenHandle handle) const;
+
+    /** Moves a running or paused tween to a point in time, clamped to its duration; returns false for stale or queued handles */
+    bool SetTweenTime(FTweenHandle handle, float time);
+
+    /**
+     * Chooses whether the transform writes of a tween are deferred in a scoped movement update
+     * Deferred actors and components update their overlaps and attached children once after every tweened transform of
+     * the frame is written. Tweens start with AdvBPTools.Tween.DeferMovementUpdates; sweeping writes are only deferred
+     * with AdvBPTools.Tween.DeferSweptMovement, so sweeps report hits and overlaps immediately.
+     *
+     * @param handle Actor or component tween to change
+     * @param bDefer Whether to defer the movement updates of its target
+     * @return False for stale handles
+     */
+    bool SetTweenDeferMovementUpdates(FTweenHandle handle, bool bDefer);
+
+    /**
+     * Moves the target of a running, paused or queued location or scale tween without restarting it
+     * The tween keeps its timer and curve; the change is blended in over the remaining time as an offset that
+     * starts with the current offset's value and velocity, so the motion stays continuous in position and velocity.
+     * The target is in the tween's own space: world space for actor and instance tweens, relative space for component tweens.
+     *
+     * @param handle Tween to retarget
+     * @param newTarget New location or scale to arrive at when the tween completes, in the tween's own space
+     * @return False for stale handles and for rotation, additive, spline and keyframe tweens
+     */
+    bool RetargetTween(FTweenHandle handle, const FVector& newTarget);
+
+    /**
+     * Moves the target of a running, paused or queued rotation tween without restarting it
+     * Like the location overload, the target is in the tween's own space.
+     *
+     * @param handle Tween to retarget
+     * @param newTarget New rotation to arrive at when the tween completes, in the tween's own space
+     * @return False for stale handles and for location, scale, additive, spline and keyframe tweens
+     */
+    bool RetargetTween(FTweenHandle handle, const FRotator& newTarget);
+
+    /**
+     * Makes a tween chase another actor, retargeting it from the followed actor's transform once per update
+     * Location tweens head for the followed actor's location plus an offset, rotation tweens for its rotation and
+     * scale tweens for its scale. If the followed actor goes away the tween finishes at the last sampled target.
+     *
+     * @param handle Actor or instance tween to change
+     * @param followActor Actor to follow; null stops following and keeps the current target
+     * @param locationOffset World-space offset from the followed actor's location, used by location tweens
+     * @return False for stale handles, component tweens and tweens RetargetTween does not support
+     */
+    bool SetTweenFollowTarget(FTweenHandle handle, AActor* followActor, const FVector& locationOffset = FVector::ZeroVector);
+
+    /**
+     * Eases a tween with a curve asset instead of its easing function
+     * The curve is baked once into a table shared by every tween using it, so tweens never evaluate the rich curve.
+     * Call right after starting the tween; pass a null curve to go back to the easing function.
+     *
+     * @param handle Tween to change
+     * @param curve Curve whose time range maps to the tween's progress; values are used as authored
+     * @param precision Size of the baked table
+     * @return False for stale handles
+     */
+    bool SetTweenEasingCurve(FTweenHandle handle, const UCurveFloat* curve, EEasingPrecision precision = EEasingPrecision::Table256);
+
+    /**
+     * Replaces the built-in distance and visibility LOD heuristic
+     * The callback runs on the game thread for each tweened actor and instanced component once every
+     * AdvBPTools.Tween.LOD.RefreshInterval updates while LOD is enabled. Pass an unbound delegate to restore the default.
+     *
+     * @param lodCallback Returns the LOD level for a target
+     */
+    void SetLodCallback(FOnAdvTweenLod&& lodCallback);
+
+    /**
+     * Plays a list of steps on an actor as one sequence
+     * Consecutive steps marked bWithPrevious form a parallel group; each group starts in the same update the
+     * previous one ended, carrying over the time that update overshot, so no frame is lost between steps.
+     * Step tweens replace whatever else drives their channel; the sequence fails if any of them fails or is cancelled.
+     *
+     * @param targetActor Actor to animate
+     * @param steps Steps in playback order
+     * @param bSweep Whether Move steps sweep for collisions
+     * @param threadingType Where the interpolation math of the steps runs
+     * @param onFinished Called once when the last step completes, a step fails or the sequence is cancelled
+     * @return Handle to the running sequence, unset if the actor is invalid or there are no steps
+     */
+    FTweenSequenceHandle StartTweenSequence(
+        AActor* targetActor,
+        TConstArrayView<FAdvTweenStep> steps,
+        bool bSweep = false,
+        EThreadingType threadingType = EThreadingType::GameThread,
+        FOnAdvTweenFinished&& onFinished = FOnAdvTweenFinished());
+
+    /** Stops a sequence and its running steps and fires its completion delegate with bSuccess false; returns false for stale handles */
+    bool CancelTweenSequence(FTweenSequenceHandle handle);
+
+    /** True until the sequence completes, fails or is cancelled */
+    bool IsTweenSequenceActive(FTweenSequenceHandle handle) const;
+
+    /** Number of tweens currently running, paused or queued */
+    int32 GetNumActiveTweens() const { return Targets.Num(); }
+
+    // Calculate duration from velocity and distance
+    static float CalculateDurationFromVelocity(const FVector& startLocation, const FVector& targetLocation, float velocity);
+
+    // Calculate duration from angular velocity
+    static float CalculateDurationFromAngularVelocity(const FRotator& startRotation, const FRotator& targetRotation, float degreesPerSecond);
+
+    // USubsystem interface
+    virtual void Initialize(FSubsystemCollectionBase& collection) override;
+    virtual void Deinitialize() override;
+
+    // FTickableGameObject interface
+    virtual void Tick(float deltaTime) override;
+    virtual bool IsTickable() const override;
+    virtual bool IsTickableInEditor() const override { return true; }
+    virtual TStatId GetStatId() const override;
+
+private:
+    enum class ETweenState : uint8
+    {
+        Running,
+        Paused,
+        Queued,
+        Cancelled
+    };
+
+    /** Sparse entry a handle points at; tracks where the tween currently sits in the dense arrays */
+    struct FTweenSlot
+    {
+        int32 DenseIndex = INDEX_NONE;
+        uint32 Generation = 1;
+    };
+
+    /**
+     * Everything the tweens of one actor want written this frame, plus the conflict bookkeeping for that actor
+     * Shared by all tweens on the actor and released when the last of them is removed
+     */
+    struct FTweenWriteRecord
+    {
+        // Either an actor written in world space or a scene component written relative to its parent
+        TWeakObjectPtr<AActor> Actor;
+        TWeakObjectPtr<USceneComponent> Component;
+        TObjectKey<UObject> TargetKey;
+        int32 RefCount = 0;
+
+        // Absolute tween currently driving each channel, and those queued behind it
+        FTweenHandle ChannelOwners[3];
+        TArray<FTweenHandle> ChannelQueues[3];
+
+        // Additive change accumulated since the current owner of each channel began
+        FVector AccumulatedLocation = FVector::ZeroVector;
+        FQuat AccumulatedRotation = FQuat::Identity;
+        FVector AccumulatedScale = FVector::ZeroVector;
+
+        // Values gathered during the current frame
+        FVector Location = FVector::ZeroVector;
+        FQuat Rotation = FQuat::Identity;
+        FVector Scale = FVector::OneVector;
+        FVector LocationIncrement = FVector::ZeroVector;
+        FQuat RotationIncrement = FQuat::Identity;
+        FVector ScaleIncrement = FVector::ZeroVector;
+        uint8 AbsoluteMask = 0;
+        uint8 AdditiveMask = 0;
+        bool bSweep = false;
+        bool bDeferMovement = false;
+        bool bDirty = false;
+
+        // Result of the last transform write, false when a sweep could not move at all; reported to tweens finishing this frame
+        bool bWriteSucceeded = true;
+
+        ETweenLodLevel LodLevel = ETweenLodLevel::Full;
+    };
+
+    /**
+     * Instance writes gathered for one instanced static mesh component, shared by all tweens on it
+     */
+    struct FTweenInstanceBatch
+    {
+        TWeakObjectPtr<UInstancedStaticMeshComponent> Component;
+        TObjectKey<UInstancedStaticMeshComponent> ComponentKey;
+        int32 RefCount = 0;
+
+        // Tween driving each instance channel, keyed by instance index * 3 + channel
+        TMap<int32, FTweenHandle> ChannelOwners;
+
+        // World transforms of the instances written this frame, and where each instance sits in that list
+        TArray<TPair<int32, FTransform>> PendingWrites;
+        TMap<int32, int32> PendingLookup;
+        bool bDirty = false;
+
+        // Result of the last batch update, reported to tweens finishing this frame
+        bool bWriteSucceeded = true;
+
+        ETweenLodLevel LodLevel = ETweenLodLevel::Full;
+    };
+
+    /**
+     * Arc-length parameterized samples of one spline, shared by all tweens following it
+     * Samples are evenly spaced by distance in the spline's local space
+     */
+    struct FTweenSplinePath
+    {
+        TWeakObjectPtr<USplineComponent> Spline;
+        TObjectKey<USplineComponent> SplineKey;
+        int32 RefCount = 0;
+
+        // Spline curve version the samples were taken from
+        uint32 Version = 0;
+        float Length = 0.0f;
+        TArray<FVector> Locations;
+        TArray<FQuat> Rotations;
+
+        // Snapshot of the spline's world transform taken on the game thread before each compute phase
+        FTransform ComponentTransform;
+        bool bValid = false;
+
+        // Samples the spline at even distance steps
+        void Build(const USplineComponent& spline);
+
+        // World-space location and rotation at a distance along the spline
+        void Sample(float distance, FVector& outLocation, FQuat& outRotation) const;
+    };
+
+    /**
+     * UPROPERTY driven by a property tween, resolved once when the tween starts
+     * Values are packed into four doubles like TAdvTweenPropertyTraits does. Recycled through a free list like tracks.
+     */
+    struct FTweenProperty
+    {
+        // Property and object it belongs to, together they key the tween owning this property
+        const FProperty* Property = nullptr;
+        TObjectKey<UObject> TargetKey;
+
+        ETweenPropertyType Type = ETweenPropertyType::Float;
+
+        FVector4d StartValue = FVector4d(0.0, 0.0, 0.0, 0.0);
+        FVector4d EndValue = FVector4d(0.0, 0.0, 0.0, 0.0);
+        FVector4d Value = FVector4d(0.0, 0.0, 0.0, 0.0);
+    };
+
+    /**
+     * Material parameter driven by a parameter tween, either custom primitive data floats or a collection parameter
+     * Recycled through a free list like tracks; the compute phase writes Value, the apply phase hands it to the batch.
+     */
+    struct FTweenParameter
+    {
+        // Collection parameter name, none for custom primitive data
+        FName ParameterName;
+
+        // First custom primitive data float, or the parameter's owner key within its collection's batch
+        int32 DataIndex = 0;
+
+        // 1 for scalars, 4 for vectors
+        int32 NumValues = 1;
+
+        FLinearColor StartValue = FLinearColor::Transparent;
+        FLinearColor EndValue = FLinearColor::Transparent;
+        FLinearColor Value = FLinearColor::Transparent;
+
+        // Custom primitive data is owned per float so overlapping ranges replace each other, collection parameters as a whole
+        int32 GetNumOwnerKeys() const { return ParameterName.IsNone() ? NumValues : 1; }
+    };
+
+    /**
+     * Parameter writes gathered for one primitive component or material parameter collection, shared by all tweens on it
+     */
+    struct FTweenParameterBatch
+    {
+        // UPrimitiveComponent for custom primitive data, UMaterialParameterCollection for collection parameters
+        TWeakObjectPtr<UObject> Target;
+        TObjectKey<UObject> TargetKey;
+        int32 RefCount = 0;
+
+        // Tween driving each parameter, keyed by custom primitive data float or collection owner key
+        TMap<int32, FTweenHandle> ParameterOwners;
+
+        // Custom primitive data written this frame over the component's current data, and the range of floats touched
+        TArray<float> PendingData;
+        int32 DirtyBegin = 0;
+        int32 DirtyEnd = 0;
+
+        // Collection parameters written this frame
+        TArray<TPair<FName, float>> PendingScalars;
+        TArray<TPair<FName, FLinearColor>> PendingVectors;
+        bool bDirty = false;
+
+        // Result of the last flush, reported to tweens finishing this frame
+        bool bWriteSucceeded = true;
+
+        ETweenLodLevel LodLevel = ETweenLodLevel::Full;
+    };
+
+    /**
+     * Keys and playback cursor of one keyframe track tween
+     * Recycled through a free list, so the key arrays keep their capacity between tweens
+     */
+    struct FTweenTrack
+    {
+        TArray<float> Times;
+        TArray<FVector> Locations;
+        TArray<FQuat> Rotations;
+        TArray<FVector> Scales;
+
+        // Kernel of the segment leading into each key
+        TArray<FEasingKernel> Kernels;
+
+        // Segment the last evaluation fell into
+        int32 Cursor = 0;
+        uint8 ChannelMask = 0;
+
+        // Compute phase output
+        FVector Location = FVector::ZeroVector;
+        FQuat Rotation = FQuat::Identity;
+        FVector Scale = FVector::OneVector;
+
+        // Adds a key at zero from the target's transform if the track starts later, and rewinds the cursor
+        void Begin(const FTransform& currentTransform);
+
+        // Evaluates the track at a time, moving the cursor forward from where it was
+        void Evaluate(float time);
+    };
+
+    /**
+     * Playback state of one tween sequence
+     * Only the current group is live as tweens; the sequence starts the next group when the last of them finishes
+     */
+    struct FTweenSequence
+    {
+        TWeakObjectPtr<AActor> Actor;
+        TArray<FAdvTweenStep> Steps;
+        FOnAdvTweenFinished OnFinished;
+
+        // First step of the next group
+        int32 NextStep = 0;
+
+        // Tweens of the current group and how many of them are still running
+        TArray<FTweenHandle, TInlineAllocator<3>> GroupHandles;
+        int32 PendingSteps = 0;
+
+        // Longest delay step of the current group still to wait out, counted from the update it started in
+        float DelayRemaining = 0.0f;
+        uint32 DelayStartUpdate = 0;
+
+        // Smallest overshoot of the steps that finished in update CarryUpdate, handed to the next group
+        float CarryTime = 0.0f;
+        uint32 CarryUpdate = 0;
+
+        EThreadingType ThreadingType = EThreadingType::GameThread;
+        bool bSweep = false;
+        bool bActive = false;
+        uint32 Generation = 1;
+    };
+
+    /**
+     * Target change blended into a tween after it started
+     * The offset from the tween's original end value follows a cubic Hermite curve from its value and velocity
+     * at the last retarget to the new offset with zero velocity at the end of the tween. Rotation offsets are
+     * rotation vectors applied in front of the eased rotation. Recycled through a free list like tracks.
+     */
+    struct FTweenRetarget
+    {
+        FVector StartOffset = FVector::ZeroVector;
+        FVector StartVelocity = FVector::ZeroVector;
+        FVector EndOffset = FVector::ZeroVector;
+        float StartTime = 0.0f;
+
+        // Followed actor, sampled on the game thread before the compute phase
+        TWeakObjectPtr<AActor> FollowActor;
+        FVector FollowOffset = FVector::ZeroVector;
+        FTransform LastFollowTransform = FTransform::Identity;
+        bool bFollowing = false;
+
+        // Offset and its rate of change at a time of a tween with the given duration
+        void Evaluate(float time, float duration, FVector& outOffset, FVector& outVelocity) const;
+    };
+
+    // Claims a slot, appends a tween to every storage array and returns its dense index
+    // recordIndex is a write record for actor tweens and an instance batch when instanceIndex is set
+    // The tween starts out queued; BeginTween captures its start values
+    int32 AddTween(
+        UObject* target,
+        int32 recordIndex,
+        int32 instanceIndex,
+        ETweenChannel channel,
+        float time,
+        EEasingFunction easingType,
+        ETweenFlags flags,
+        EThreadingType threadingType,
+        FOnAdvTweenFinished&& onFinished);
+
+    // Applies the conflict policy to a freshly added tween and either begins or queues it
+    FTweenHandle ResolveConflict(int32 index, ETweenConflictPolicy conflictPolicy);
+
+    // Replaces whatever drives the same instance channel and begins a freshly added instance tween
+    FTweenHandle BeginInstanceTween(int32 index);
+
+    // Cancels the tweens a freshly added tween replaces, then begins it; INDEX_NONE if their handlers cancelled it too
+    int32 BeginReplacingTweens(FTweenHandle handle, TConstArrayView<FTweenHandle> replacedHandles);
+
+    // Captures start values from the target, resolves velocity timing and marks the tween running
+    void BeginTween(int32 index);
+
+    // Current transform of a tween's target, relative for scene components; false if the actor, component or instance is gone
+    bool GetTargetTransform(int32 index, FTransform& outTransform) const;
+
+    // Begins the next queued tween of every channel whose owner was removed since the last call
+    void StartQueuedTweens();
+
+    // Finds or creates the write record for an actor or scene component and takes a reference on it
+    int32 AcquireWriteRecord(UObject* target);
+
+    // Drops a reference on a write record, freeing it with the last one
+    void ReleaseWriteRecord(int32 recordIndex);
+
+    // Composes and writes the transform gathered for an actor or component this frame
+    void FlushWriteRecord(FTweenWriteRecord& record);
+
+    // Component whose movement updates a write record's flush should defer this frame, or null
+    USceneComponent* GetDeferredMovementComponent(const FTweenWriteRecord& record) const;
+
+    // Finds or creates the instance batch for a component and takes a reference on it
+    int32 AcquireInstanceBatch(UInstancedStaticMeshComponent* component);
+
+    // Drops a reference on an instance batch, freeing it with the last one
+    void ReleaseInstanceBatch(int32 batchIndex);
+
+    // Writes the computed value of an instance tween into its batch; false if the instance is gone
+    bool ApplyInstanceResult(int32 index);
+
+    // Adds a parameter tween on a primitive component or collection, replacing whatever drives the same parameter
+    FTweenHandle StartParameterTween(
+        UObject* target,
+        FName parameterName,
+        int32 dataIndex,
+        int32 numValues,
+        const FLinearColor& desiredValue,
+        float duration,
+        EEasingFunction easingType,
+        EThreadingType threadingType,
+        FOnAdvTweenFinished&& onFinished);
+
+    // Current value of a parameter tween's parameter; false if its component or collection instance is gone
+    bool GetParameterValue(int32 index, FLinearColor& outValue) const;
+
+    // Finds or creates the parameter batch for a component or collection and takes a reference on it
+    int32 AcquireParameterBatch(UObject* target);
+
+    // Drops a reference on a parameter batch, freeing it with the last one
+    void ReleaseParameterBatch(int32 batchIndex);
+
+    // Writes the computed value of a parameter tween into its batch
+    void ApplyParameterResult(int32 index);
+
+    // Sets the parameters gathered for a component or collection this frame
+    void FlushParameterBatch(FTweenParameterBatch& batch);
+
+    // Takes a parameter entry from the free list or adds one
+    int32 AllocateParameter();
+
+    // Resolves a property once and adds a property tween for it
+    FTweenHandle StartPropertyTweenPacked(
+        UObject* target,
+        FName propertyName,
+        ETweenPropertyType type,
+        const FVector4d& desiredValue,
+        float duration,
+        EEasingFunction easingType,
+        EThreadingType threadingType,
+        FOnAdvTweenFinished&& onFinished);
+
+    // Resolves a property once per class and adds a property tween on each target
+    TArray<FTweenHandle> StartPropertyTweensPacked(
+        TConstArrayView<UObject*> targets,
+        FName propertyName,
+        ETweenPropertyType type,
+        const FVector4d& desiredValue,
+        float duration,
+        EEasingFunction easingType,
+        EThreadingType threadingType);
+
+    // Adds a property tween for an already resolved property, replacing whatever drives it
+    FTweenHandle AddPropertyTween(
+        UObject* target,
+        const FProperty* property,
+        ETweenPropertyType propertyType,
+        const FVector4d& desiredValue,
+        float duration,
+        EEasingFunction easingType,
+        EThreadingType threadingType,
+        FOnAdvTweenFinished&& onFinished);
+
+    // Copies the computed value of a property tween into its object
+    void WritePropertyResult(int32 index);
+
+    // Starts groups of a sequence until one is still running, completing the sequence after its last step
+    void StartSequenceGroup(int32 sequenceIndex, float carryTime);
+
+    // Completion of a sequence step tween; stale generations belong to sequences that already ended
+    void HandleSequenceStepFinished(bool bSuccess, int32 sequenceIndex, uint32 generation);
+
+    // Records how far a finished step overshot its duration this update
+    void NoteSequenceCarry(int32 sequenceIndex, float overshoot);
+
+    // Ends a sequence, cancels its running steps and fires its completion delegate
+    void FinishSequence(int32 sequenceIndex, bool bSuccess);
+
+    // Counts down delay steps and hands off groups whose delay ran out
+    void AdvanceSequenceDelays(float updateTime);
+
+    // Removes the tweens that finished this update, starts queued ones and fires completion delegates
+    void RetireFinishedTweens();
+
+    // Completion and failure counters of stat AdvBPTools and the CSV profiler
+    void CountFinishedTween(bool bSuccess);
+
+#if STATS
+    // Active tween counts per kind for stat AdvBPTools
+    void UpdateTweenCountStats() const;
+#endif
+
+    // Blends a new end value into a tween; the vector is used by location and scale tweens, the quaternion by rotation ones
+    bool RetargetAtIndex(int32 index, const FVector& newEndVector, const FQuat& newEndQuat);
+
+    // Samples followed actors and retargets the tweens chasing them
+    void UpdateFollowTargets();
+
+    // Takes a track from the free list or adds one
+    int32 AllocateTrack();
+
+    // Finds or builds the arc-length table for a spline and takes a reference on it
+    int32 AcquireSplinePath(USplineComponent* spline);
+
+    // Drops a reference on a spline path, freeing it with the last one
+    void ReleaseSplinePath(int32 pathIndex);
+
+    // Snapshots spline transforms and rebuilds tables of edited splines before the compute phase
+    void UpdateSplinePaths();
+
+    // Applies the instance transforms gathered for a component this frame and dirties its render state once
+    void FlushInstanceBatch(FTweenInstanceBatch& batch);
+
+    // Handle for the tween at a dense index
+    FTweenHandle MakeHandle(int32 index) const;
+
+    // Removes a tween by swapping the last one into its place and retires its slot
+    void RemoveTweenAtSwap(int32 index);
+
+    // Dense index of a live tween, or INDEX_NONE for stale handles
+    int32 FindDenseIndex(FTweenHandle handle) const;
+
+    // Re-evaluates the LOD level of the write records, instance batches and parameter batches due this update
+    void RefreshLodLevels();
+
+    // Compute phase: evaluates the eased value of each listed tween into the result arrays
+    // Touches no UObjects, so it is safe to run on worker threads for disjoint index lists
+    void ComputeTweens(TConstArrayView<int32> indices);
+
+    // Splits an index list into batches and launches a compute task for each
+    void LaunchComputeTasks(TConstArrayView<int32> indices, UE::Tasks::ETaskPriority priority);
+
+    // Handle table; freed slots are recycled with a bumped generation
+    TArray<FTweenSlot> Slots;
+    TArray<int32> FreeSlots;
+
+    // Write records shared by all tweens on the same actor or scene component
+    TArray<FTweenWriteRecord> WriteRecords;
+    TArray<int32> FreeWriteRecords;
+    TMap<TObjectKey<UObject>, int32> WriteRecordLookup;
+
+    // Instance batches shared by all tweens on the same instanced static mesh component
+    TArray<FTweenInstanceBatch> InstanceBatches;
+    TArray<int32> FreeInstanceBatches;
+    TMap<TObjectKey<UInstancedStaticMeshComponent>, int32> InstanceBatchLookup;
+
+    // Parameter batches shared by all parameter tweens on the same primitive component or collection
+    TArray<FTweenParameterBatch> ParameterBatches;
+    TArray<int32> FreeParameterBatches;
+    TMap<TObjectKey<UObject>, int32> ParameterBatchLookup;
+
+    // Material parameters, one per parameter tween
+    TArray<FTweenParameter> Parameters;
+    TArray<int32> FreeParameters;
+
+    // Properties, one per property tween, and the tween driving each property of each object
+    TArray<FTweenProperty> Properties;
+    TArray<int32> FreeProperties;
+    TMap<TPair<TObjectKey<UObject>, const FProperty*>, FTweenHandle> PropertyOwners;
+
+    // Arc-length tables shared by all tweens following the same spline
+    TArray<FTweenSplinePath> SplinePaths;
+    TArray<int32> FreeSplinePaths;
+    TMap<TObjectKey<USplineComponent>, int32> SplinePathLookup;
+
+    // Keyframe tracks, one per track tween
+    TArray<FTweenTrack> Tracks;
+    TArray<int32> FreeTracks;
+
+    // Retargets, one per retargeted tween
+    TArray<FTweenRetarget> Retargets;
+    TArray<int32> FreeRetargets;
+    int32 NumFollowing = 0;
+
+    // Sequences, with a free list so sequence handles can be recycled
+    TArray<FTweenSequence> Sequences;
+    TArray<int32> FreeSequences;
+    int32 NumActiveSequences = 0;
+
+    // Tween storage, one entry per active tween in every array
+    TArray<int32> SlotIndices;
+    TArray<TWeakObjectPtr<UObject>> Targets;
+    TArray<int32> WriteRecordIndices;
+    TArray<int32> InstanceIndices;
+    TArray<int32> SplinePathIndices;
+    TArray<int32> TrackIndices;
+    TArray<int32> SequenceIndices;
+    TArray<int32> RetargetIndices;
+    TArray<int32> ParameterIndices;
+    TArray<int32> PropertyIndices;
+    TArray<ETweenChannel> Channels;
+    TArray<ETweenState> States;
+    TArray<ETweenFlags> Flags;
+    TArray<FEasingKernel> EasingKernels;
+
+    // Baked curve assets, null for tweens using their easing kernel
+    TArray<TSharedPtr<const FAdvEasingTable>> EasingTables;
+    TArray<float> ElapsedTimes;
+    TArray<float> Durations;
+    TArray<EThreadingType> ThreadingTypes;
+
+    // Location and scale endpoints; unused for rotation tweens. Additive tweens run from zero to their offset
+    // Spline tweens keep their start and end distance along the spline in X
+    TArray<FVector> StartVectors;
+    TArray<FVector> EndVectors;
+
+    // Rotation endpoints; unused for location and scale tweens. Additive tweens run from identity to their delta
+    TArray<FQuat> StartQuats;
+    TArray<FQuat> EndQuats;
+
+    // Offset an additive tween had already contributed, so each frame only adds the difference
+    TArray<FVector> AppliedVectors;
+    TArray<FQuat> AppliedQuats;
+
+    TArray<FOnAdvTweenFinished> FinishedDelegates;
+
+    // Compute phase output, written by the compute phase and read by the apply phase
+    TArray<FVector> ResultVectors;
+    TArray<FQuat> ResultQuats;
+
+    // Per-frame scratch, kept as members so capacity survives between frames
+    TArray<int32> GameThreadIndices;
+    TArray<int32> HighPrioIndices;
+    TArray<int32> NormalPrioIndices;
+    TBitArray<> EvaluatedMask;
+    TArray<UE::Tasks::FTask> ComputeTasks;
+    TArray<int32> DirtyWriteRecords;
+    TArray<int32> DirtyInstanceBatches;
+    TArray<int32> DirtyParameterBatches;
+    TArray<FTransform> InstanceRunTransforms;
+    TArray<int32> FinishedIndices;
+    TArray<int32> FinishedRecords;
+    TArray<TPair<int32, ETweenChannel>> PendingPromotions;
+    TArray<TPair<FOnAdvTweenFinished, bool>> PendingNotifies;
+
+    FOnAdvTweenLod LodCallback;
+
+    // Updates run so far, staggers LOD refreshes and reduced rate evaluations
+    uint32 UpdateCounter = 0;
+
+    // Time owed to the fixed step update mode that did not add up to a whole step yet
+    float FixedStepAccumulator = 0.0f;
+
+    // Set while storage is being iterated; cancellations are then deferred to the apply phase
+    bool bIsUpdating = false;
+};
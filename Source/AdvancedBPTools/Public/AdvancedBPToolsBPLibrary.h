@@ -17,5 +17,117 @@ class ADVANCEDBPTOOLS_API UAdvancedBPToolsBPLibrary : public UBlueprintFunctionL
 {
     GENERATED_UCLASS_BODY()
 
-  
-};
\ No newline at end of file
+    /**
+     * Moves an actor to specified location as a latent action
+     * Lighter than the async node: runs in the latent action manager without spawning a task object
+     *
+     * @param worldContextObject Object providing the world and owning the latent action
+     * @param targetActor Actor to move
+     * @param desiredLocation Target destination
+     * @param duration Time in seconds
+     * @param easingType Interpolation curve type
+     * @param bSweep Whether to sweep for collisions during movement
+     * @param outResult Exec branch taken when the action ends
+     * @param latentInfo Latent action bookkeeping filled in by the Blueprint compiler
+     */
+    UFUNCTION(BlueprintCallable,
+        meta = (Latent,
+            LatentInfo = "latentInfo",
+            WorldContext = "worldContextObject",
+            ExpandEnumAsExecs = "outResult",
+            DisplayName = "Move Actor To Location (Latent)",
+            Keywords = "move,location,latent,interpolate,animation,duration"),
+        Category = "AdvBPTools|Movement")
+    static void MoveActorToLocationLatent(
+        UObject* worldContextObject,
+        AActor* targetActor,
+        FVector desiredLocation,
+        float duration,
+        EEasingFunction easingType,
+        bool bSweep,
+        ELatentActionResult& outResult,
+        FLatentActionInfo latentInfo);
+
+    /**
+     * Rotates an actor to specified rotation as a latent action using quaternion Slerp
+     *
+     * @param worldContextObject Object providing the world and owning the latent action
+     * @param targetActor Actor to rotate
+     * @param desiredRotation Target rotation
+     * @param duration Time in seconds
+     * @param easingType Interpolation curve type
+     * @param outResult Exec branch taken when the action ends
+     * @param latentInfo Latent action bookkeeping filled in by the Blueprint compiler
+     */
+    UFUNCTION(BlueprintCallable,
+        meta = (Latent,
+            LatentInfo = "latentInfo",
+            WorldContext = "worldContextObject",
+            ExpandEnumAsExecs = "outResult",
+            DisplayName = "Rotate Actor (Latent)",
+            Keywords = "rotate,rotation,latent,interpolate,animation"),
+        Category = "AdvBPTools|Movement")
+    static void RotateActorLatent(
+        UObject* worldContextObject,
+        AActor* targetActor,
+        FRotator desiredRotation,
+        float duration,
+        EEasingFunction easingType,
+        ELatentActionResult& outResult,
+        FLatentActionInfo latentInfo);
+
+    /**
+     * Scales an actor to specified scale as a latent action
+     *
+     * @param worldContextObject Object providing the world and owning the latent action
+     * @param targetActor Actor to scale
+     * @param desiredScale Target scale
+     * @param duration Time in seconds
+     * @param easingType Interpolation curve type
+     * @param outResult Exec branch taken when the action ends
+     * @param latentInfo Latent action bookkeeping filled in by the Blueprint compiler
+     */
+    UFUNCTION(BlueprintCallable,
+        meta = (Latent,
+            LatentInfo = "latentInfo",
+            WorldContext = "worldContextObject",
+            ExpandEnumAsExecs = "outResult",
+            DisplayName = "Scale Actor (Latent)",
+            Keywords = "scale,size,latent,interpolate,animation"),
+        Category = "AdvBPTools|Movement")
+    static void ScaleActorLatent(
+        UObject* worldContextObject,
+        AActor* targetActor,
+        FVector desiredScale,
+        float duration,
+        EEasingFunction easingType,
+        ELatentActionResult& outResult,
+        FLatentActionInfo latentInfo);
+
+    /**
+     * Moves the target of a running location or scale tween without restarting it, blending so the target keeps its velocity
+     *
+     * @param worldContextObject Any object living in the tween's world
+     * @param tweenHandle Handle from the tween's async node
+     * @param newTarget New location or scale: world space for actor and instance tweens, relative space for component tweens
+     * @return False if the tween already finished or cannot be retargeted
+     */
+    UFUNCTION(BlueprintCallable, meta = (WorldContext = "worldContextObject"), Category = "AdvBPTools|Movement")
+    static bool RetargetTween(UObject* worldContextObject, FAdvTweenHandle tweenHandle, FVector newTarget);
+
+    /**
+     * Moves the target of a running rotation tween without restarting it, blending so the target keeps turning smoothly
+     *
+     * @param worldContextObject Any object living in the tween's world
+     * @param tweenHandle Handle from the tween's async node
+     * @param newTarget New rotation: world space for actor and instance tweens, relative space for component tweens
+     * @return False if the tween already finished or cannot be retargeted
+     */
+    UFUNCTION(BlueprintCallable, meta = (WorldContext = "worldContextObject"), Category = "AdvBPTools|Movement")
+    static bool RetargetRotationTween(UObject* worldContextObject, FAdvTweenHandle tweenHandle, FRotator newTarget);
+
+private:
+    // Registers a latent action unless one with the same UUID is already running on the callback target
+    template<typename TAction, typename... TArgs>
+    static void StartLatentAction(UObject* worldContextObject, const FLatentActionInfo& latentInfo, TArgs&&... args);
+};
@@ -5,12 +5,28 @@
 #include "CoreMinimal.h"
 #include "Kismet/BlueprintAsyncActionBase.h"
 #include "AdvBPTypes.h"
+#include "AdvTweenSubsystem.h"
 #include "AsyncTools.generated.h"
 
-DECLARE_DYNAMIC_MULTICAST_DELEGATE(FAsyncTransformTaskOutputPin);
+class UInstancedStaticMeshComponent;
+class UMaterialParameterCollection;
+class UPrimitiveComponent;
+class USceneComponent;
+class USplineComponent;
+class UCurveFloat;
 
-UCLASS()
-class UAsyncMoveActorTask : public UBlueprintAsyncActionBase
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FAsyncTransformTaskOutputPin, FAdvTweenHandle, TweenHandle);
+
+/**
+ * Shared base of the tween-driven async tasks
+ * Owns the completion pins, the tween handle and the hand-back to the world's task pool
+ *
+ * A pooled task is given to a new node as soon as it completes, so nothing may call into it after OnSuccess or
+ * OnFailed fired. Tasks expose no Blueprint callable methods; running tweens are reached through the FAdvTweenHandle
+ * output pin, whose generation goes stale with the tween
+ */
+UCLASS(Abstract)
+class UAdvAsyncTweenTask : public UBlueprintAsyncActionBase
 {
     GENERATED_BODY()
 
@@ -22,6 +38,30 @@ public:
     UPROPERTY(BlueprintAssignable)
     FAsyncTransformTaskOutputPin OnFailed;
 
+protected:
+    // Handle task completion, invoked by the tween subsystem
+    void HandleTaskComplete(bool bSuccess);
+
+    // Clears the references specific to one task class before the instance is reused
+    virtual void ResetTaskReferences() {}
+
+    UPROPERTY()
+    UObject* WorldContextObject;
+
+    // Tween driving this task in the world's tween subsystem
+    FTweenHandle TweenHandle;
+
+private:
+    // Clear per-run state and hand this instance back to the world's task pool
+    void ReturnToPool();
+};
+
+UCLASS()
+class UAsyncMoveActorTask : public UAdvAsyncTweenTask
+{
+    GENERATED_BODY()
+
+public:
     /**
      * Moves an actor to specified location
      *
@@ -31,10 +71,14 @@ public:
      * @param TimingMode Whether to use duration or velocity for timing
      * @param EasingType Interpolation curve type
      * @param bSweep Whether to sweep for collisions during movement
+     * @param ThreadingType Where the interpolation math runs; the actor is always moved on the game thread
+     * @param ConflictPolicy What to do if another tween already drives this channel of the actor
+     * @param EasingCurve Optional curve asset used instead of EasingType, baked once into a shared table
      */
     UFUNCTION(BlueprintCallable,
         meta = (BlueprintInternalUseOnly = "true",
             WorldContext = "worldContextObject",
+            AdvancedDisplay = "threadingType,conflictPolicy,easingCurve",
             DisplayName = "Move Actor To Location",
             Keywords = "move,location,async,interpolate,animation,duration,velocity,speed"),
         Category = "AdvBPTools|Movement")
@@ -45,19 +89,23 @@ public:
         float time = 1.0f,
         EMoveTimingMode timingMode = EMoveTimingMode::Duration,
         EEasingFunction easingType = EEasingFunction::Linear,
-        bool bSweep = false);
+        bool bSweep = false,
+        EThreadingType threadingType = EThreadingType::GameThread,
+        ETweenConflictPolicy conflictPolicy = ETweenConflictPolicy::Replace,
+        UCurveFloat* easingCurve = nullptr);
 
     // UBlueprintAsyncActionBase interface
     virtual void Activate() override;
 
+    // Fired once the tween is running, with the handle RetargetTween takes
+    UPROPERTY(BlueprintAssignable)
+    FAsyncTransformTaskOutputPin OnStarted;
+
 private:
     // Task parameters
     UPROPERTY()
     AActor* TargetActor;
 
-    UPROPERTY()
-    UObject* WorldContextObject;
-
     UPROPERTY()
     FVector DesiredLocation;
 
@@ -65,26 +113,22 @@ private:
     float Duration;
 
     UPROPERTY()
-    float ElapsedTime;
+    EEasingFunction EasingType;
 
     UPROPERTY()
-    FVector InitialLocation;
+    bool bSweep;
 
     UPROPERTY()
-    EEasingFunction EasingType;
+    EThreadingType ThreadingType;
 
     UPROPERTY()
-    bool bSweep;
+    ETweenConflictPolicy ConflictPolicy;
 
-    // Timer handle for movement updates
-    FTimerHandle TimerHandle;
-
-    // Handle task completion
-    void HandleTaskComplete(bool bSuccess);
+    UPROPERTY()
+    UCurveFloat* EasingCurve;
 
-    // Tick handler for movement updates
-    UFUNCTION()
-    void TickTask();
+    // UAdvAsyncTweenTask interface
+    virtual void ResetTaskReferences() override;
 
     // Initialize task with common parameters
     void InitializeTask(
@@ -93,28 +137,20 @@ private:
         FVector desiredLocation,
         float duration,
         EEasingFunction easingType,
-        bool bSweep);
-
-    // Calculate duration from velocity and distance
-    static float CalculateDurationFromVelocity(const FVector& startLocation, const FVector& targetLocation, float velocity);
+        bool bSweep,
+        EThreadingType threadingType,
+        ETweenConflictPolicy conflictPolicy);
 };
 
 /**
  * Asynchronous task for rotating actors with precise control
  */
 UCLASS()
-class UAsyncRotateActorTask : public UBlueprintAsyncActionBase
+class UAsyncRotateActorTask : public UAdvAsyncTweenTask
 {
     GENERATED_BODY()
 
 public:
-    // Completion delegates
-    UPROPERTY(BlueprintAssignable)
-    FAsyncTransformTaskOutputPin OnSuccess;
-
-    UPROPERTY(BlueprintAssignable)
-    FAsyncTransformTaskOutputPin OnFailed;
-
     /**
      * Rotates an actor to specified rotation
      *
@@ -124,10 +160,14 @@ public:
      * @param TimingMode Whether to use duration or angular velocity for timing
      * @param EasingType Interpolation curve type
      * @param bShortestPath Whether to take the shortest path for rotation
+     * @param ThreadingType Where the interpolation math runs; the actor is always rotated on the game thread
+     * @param ConflictPolicy What to do if another tween already drives this channel of the actor
+     * @param EasingCurve Optional curve asset used instead of EasingType, baked once into a shared table
      */
     UFUNCTION(BlueprintCallable,
         meta = (BlueprintInternalUseOnly = "true",
             WorldContext = "worldContextObject",
+            AdvancedDisplay = "threadingType,conflictPolicy,easingCurve",
             DisplayName = "Rotate Actor",
             Keywords = "rotate,rotation,async,interpolate,animation,duration,velocity,speed"),
         Category = "AdvBPTools|Movement")
@@ -138,19 +178,23 @@ public:
         float time = 1.0f,
         EMoveTimingMode timingMode = EMoveTimingMode::Duration,
         EEasingFunction easingType = EEasingFunction::Linear,
-        bool bShortestPath = true);
+        bool bShortestPath = true,
+        EThreadingType threadingType = EThreadingType::GameThread,
+        ETweenConflictPolicy conflictPolicy = ETweenConflictPolicy::Replace,
+        UCurveFloat* easingCurve = nullptr);
 
     // UBlueprintAsyncActionBase interface
     virtual void Activate() override;
 
+    // Fired once the tween is running, with the handle RetargetRotationTween takes
+    UPROPERTY(BlueprintAssignable)
+    FAsyncTransformTaskOutputPin OnStarted;
+
 private:
     // Task parameters
     UPROPERTY()
     AActor* TargetActor;
 
-    UPROPERTY()
-    UObject* WorldContextObject;
-
     UPROPERTY()
     FRotator DesiredRotation;
 
@@ -158,30 +202,22 @@ private:
     float Duration;
 
     UPROPERTY()
-    float ElapsedTime;
+    EEasingFunction EasingType;
 
     UPROPERTY()
-    FRotator InitialRotation;
-
-    // Cached quaternions for efficient interpolation
-    FQuat InitialQuat;
-    FQuat TargetQuat;
+    bool bShortestPath;
 
     UPROPERTY()
-    EEasingFunction EasingType;
+    EThreadingType ThreadingType;
 
     UPROPERTY()
-    bool bShortestPath;
-
-    // Timer handle for rotation updates
-    FTimerHandle TimerHandle;
+    ETweenConflictPolicy ConflictPolicy;
 
-    // Handle task completion
-    void HandleTaskComplete(bool bSuccess);
+    UPROPERTY()
+    UCurveFloat* EasingCurve;
 
-    // Tick handler for rotation updates
-    UFUNCTION()
-    void TickTask();
+    // UAdvAsyncTweenTask interface
+    virtual void ResetTaskReferences() override;
 
     // Initialize task with common parameters
     void InitializeTask(
@@ -190,28 +226,20 @@ private:
         FRotator desiredRotation,
         float duration,
         EEasingFunction easingType,
-        bool bShortestPath);
-
-    // Calculate duration from angular velocity
-    static float CalculateDurationFromAngularVelocity(const FRotator& startRotation, const FRotator& targetRotation, float degreesPerSecond);
+        bool bShortestPath,
+        EThreadingType threadingType,
+        ETweenConflictPolicy conflictPolicy);
 };
 
 /**
  * Asynchronous task for scaling actors with precise control
  */
 UCLASS()
-class UAsyncScaleActorTask : public UBlueprintAsyncActionBase
+class UAsyncScaleActorTask : public UAdvAsyncTweenTask
 {
     GENERATED_BODY()
 
 public:
-    // Completion delegates
-    UPROPERTY(BlueprintAssignable)
-    FAsyncTransformTaskOutputPin OnSuccess;
-
-    UPROPERTY(BlueprintAssignable)
-    FAsyncTransformTaskOutputPin OnFailed;
-
     /**
      * Scales an actor to specified scale
      *
@@ -219,10 +247,14 @@ public:
      * @param DesiredScale Target scale
      * @param Duration Time to complete the scaling
      * @param EasingType Interpolation curve type
+     * @param ThreadingType Where the interpolation math runs; the actor is always scaled on the game thread
+     * @param ConflictPolicy What to do if another tween already drives this channel of the actor
+     * @param EasingCurve Optional curve asset used instead of EasingType, baked once into a shared table
      */
     UFUNCTION(BlueprintCallable,
         meta = (BlueprintInternalUseOnly = "true",
             WorldContext = "worldContextObject",
+            AdvancedDisplay = "threadingType,conflictPolicy,easingCurve",
             DisplayName = "Scale Actor",
             Keywords = "scale,size,async,interpolate,animation"),
         Category = "AdvBPTools|Movement")
@@ -231,7 +263,10 @@ public:
         AActor* targetActor,
         FVector desiredScale,
         float duration = 1.0f,
-        EEasingFunction easingType = EEasingFunction::Linear);
+        EEasingFunction easingType = EEasingFunction::Linear,
+        EThreadingType threadingType = EThreadingType::GameThread,
+        ETweenConflictPolicy conflictPolicy = ETweenConflictPolicy::Replace,
+        UCurveFloat* easingCurve = nullptr);
 
     // UBlueprintAsyncActionBase interface
     virtual void Activate() override;
@@ -241,9 +276,6 @@ private:
     UPROPERTY()
     AActor* TargetActor;
 
-    UPROPERTY()
-    UObject* WorldContextObject;
-
     UPROPERTY()
     FVector DesiredScale;
 
@@ -251,23 +283,19 @@ private:
     float Duration;
 
     UPROPERTY()
-    float ElapsedTime;
+    EEasingFunction EasingType;
 
     UPROPERTY()
-    FVector InitialScale;
+    EThreadingType ThreadingType;
 
     UPROPERTY()
-    EEasingFunction EasingType;
+    ETweenConflictPolicy ConflictPolicy;
 
-    // Timer handle for scaling updates
-    FTimerHandle TimerHandle;
-
-    // Handle task completion
-    void HandleTaskComplete(bool bSuccess);
+    UPROPERTY()
+    UCurveFloat* EasingCurve;
 
-    // Tick handler for scaling updates
-    UFUNCTION()
-    void TickTask();
+    // UAdvAsyncTweenTask interface
+    virtual void ResetTaskReferences() override;
 
     // Initialize task with common parameters
     void InitializeTask(
@@ -275,5 +303,891 @@ private:
         AActor* targetActor,
         FVector desiredScale,
         float duration,
-        EEasingFunction easingType);
-};
\ No newline at end of file
+        EEasingFunction easingType,
+        EThreadingType threadingType,
+        ETweenConflictPolicy conflictPolicy);
+};
+
+/**
+ * Asynchronous task for tweening single instances of an instanced static mesh component
+ * All instances tweened on the same component are updated in one batch per frame
+ */
+UCLASS()
+class UAsyncTweenInstanceTask : public UAdvAsyncTweenTask
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Moves an instance to specified world location
+     *
+     * @param Component Instanced static mesh component owning the instance
+     * @param InstanceIndex Index of the instance to move
+     * @param DesiredLocation Target destination in world space
+     * @param Time Time in seconds or units per second (depending on timingMode)
+     * @param TimingMode Whether to use duration or velocity for timing
+     * @param EasingType Interpolation curve type
+     * @param ThreadingType Where the interpolation math runs; the instance is always moved on the game thread
+     */
+    UFUNCTION(BlueprintCallable,
+        meta = (BlueprintInternalUseOnly = "true",
+            WorldContext = "worldContextObject",
+            AdvancedDisplay = "threadingType",
+            DisplayName = "Move Instance To Location",
+            Keywords = "move,location,async,interpolate,animation,instance,ism,hism"),
+        Category = "AdvBPTools|Movement")
+    static UAsyncTweenInstanceTask* MoveInstance(
+        UObject* worldContextObject,
+        UInstancedStaticMeshComponent* component,
+        int32 instanceIndex,
+        FVector desiredLocation,
+        float time = 1.0f,
+        EMoveTimingMode timingMode = EMoveTimingMode::Duration,
+        EEasingFunction easingType = EEasingFunction::Linear,
+        EThreadingType threadingType = EThreadingType::GameThread);
+
+    /**
+     * Rotates an instance to specified world rotation
+     *
+     * @param Component Instanced static mesh component owning the instance
+     * @param InstanceIndex Index of the instance to rotate
+     * @param DesiredRotation Target rotation in world space
+     * @param Time Time in seconds or degrees per second (depending on timingMode)
+     * @param TimingMode Whether to use duration or angular velocity for timing
+     * @param EasingType Interpolation curve type
+     * @param bShortestPath Whether to take the shortest path for rotation
+     * @param ThreadingType Where the interpolation math runs; the instance is always rotated on the game thread
+     */
+    UFUNCTION(BlueprintCallable,
+        meta = (BlueprintInternalUseOnly = "true",
+            WorldContext = "worldContextObject",
+            AdvancedDisplay = "threadingType",
+            DisplayName = "Rotate Instance",
+            Keywords = "rotate,rotation,async,interpolate,animation,instance,ism,hism"),
+        Category = "AdvBPTools|Movement")
+    static UAsyncTweenInstanceTask* RotateInstance(
+        UObject* worldContextObject,
+        UInstancedStaticMeshComponent* component,
+        int32 instanceIndex,
+        FRotator desiredRotation,
+        float time = 1.0f,
+        EMoveTimingMode timingMode = EMoveTimingMode::Duration,
+        EEasingFunction easingType = EEasingFunction::Linear,
+        bool bShortestPath = true,
+        EThreadingType threadingType = EThreadingType::GameThread);
+
+    /**
+     * Scales an instance to specified scale
+     *
+     * @param Component Instanced static mesh component owning the instance
+     * @param InstanceIndex Index of the instance to scale
+     * @param DesiredScale Target scale
+     * @param Duration Time in seconds
+     * @param EasingType Interpolation curve type
+     * @param ThreadingType Where the interpolation math runs; the instance is always scaled on the game thread
+     */
+    UFUNCTION(BlueprintCallable,
+        meta = (BlueprintInternalUseOnly = "true",
+            WorldContext = "worldContextObject",
+            AdvancedDisplay = "threadingType",
+            DisplayName = "Scale Instance",
+            Keywords = "scale,size,async,interpolate,animation,instance,ism,hism"),
+        Category = "AdvBPTools|Movement")
+    static UAsyncTweenInstanceTask* ScaleInstance(
+        UObject* worldContextObject,
+        UInstancedStaticMeshComponent* component,
+        int32 instanceIndex,
+        FVector desiredScale,
+        float duration = 1.0f,
+        EEasingFunction easingType = EEasingFunction::Linear,
+        EThreadingType threadingType = EThreadingType::GameThread);
+
+    // UBlueprintAsyncActionBase interface
+    virtual void Activate() override;
+
+private:
+    // Task parameters
+    UPROPERTY()
+    UInstancedStaticMeshComponent* Component;
+
+    UPROPERTY()
+    int32 InstanceIndex;
+
+    UPROPERTY()
+    FVector DesiredVector;
+
+    UPROPERTY()
+    FRotator DesiredRotation;
+
+    UPROPERTY()
+    float Time;
+
+    UPROPERTY()
+    EMoveTimingMode TimingMode;
+
+    UPROPERTY()
+    EEasingFunction EasingType;
+
+    UPROPERTY()
+    bool bShortestPath;
+
+    UPROPERTY()
+    EThreadingType ThreadingType;
+
+    // Transform channel this run drives
+    ETweenChannel Channel;
+
+    // UAdvAsyncTweenTask interface
+    virtual void ResetTaskReferences() override;
+
+    // Create a task from the pool and store the parameters shared by all channels
+    static UAsyncTweenInstanceTask* CreateTask(
+        UObject* worldContextObject,
+        UInstancedStaticMeshComponent* component,
+        int32 instanceIndex,
+        ETweenChannel channel,
+        float time,
+        EMoveTimingMode timingMode,
+        EEasingFunction easingType,
+        EThreadingType threadingType);
+};
+
+/**
+ * Asynchronous task for tweening a scene component relative to its parent
+ * Only the component and what is attached below it move, the owning actor stays where it is
+ */
+UCLASS()
+class UAsyncTweenComponentTask : public UAdvAsyncTweenTask
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Moves a component to specified relative location
+     *
+     * @param Component Scene component to move
+     * @param DesiredLocation Target destination relative to the component's parent
+     * @param Time Time in seconds or units per second (depending on timingMode)
+     * @param TimingMode Whether to use duration or velocity for timing
+     * @param EasingType Interpolation curve type
+     * @param bSweep Whether to sweep for collisions during movement
+     * @param ThreadingType Where the interpolation math runs; the component is always moved on the game thread
+     * @param ConflictPolicy What to do if another tween already drives this channel of the component
+     */
+    UFUNCTION(BlueprintCallable,
+        meta = (BlueprintInternalUseOnly = "true",
+            WorldContext = "worldContextObject",
+            AdvancedDisplay = "threadingType,conflictPolicy",
+            DisplayName = "Move Component To Relative Location",
+            Keywords = "move,location,relative,component,async,interpolate,animation,duration,velocity,speed"),
+        Category = "AdvBPTools|Movement")
+    static UAsyncTweenComponentTask* MoveComponent(
+        UObject* worldContextObject,
+        USceneComponent* component,
+        FVector desiredLocation,
+        float time = 1.0f,
+        EMoveTimingMode timingMode = EMoveTimingMode::Duration,
+        EEasingFunction easingType = EEasingFunction::Linear,
+        bool bSweep = false,
+        EThreadingType threadingType = EThreadingType::GameThread,
+        ETweenConflictPolicy conflictPolicy = ETweenConflictPolicy::Replace);
+
+    /**
+     * Rotates a component to specified relative rotation
+     *
+     * @param Component Scene component to rotate
+     * @param DesiredRotation Target rotation relative to the component's parent
+     * @param Time Time in seconds or degrees per second (depending on timingMode)
+     * @param TimingMode Whether to use duration or angular velocity for timing
+     * @param EasingType Interpolation curve type
+     * @param bShortestPath Whether to take the shortest path for rotation
+     * @param ThreadingType Where the interpolation math runs; the component is always rotated on the game thread
+     * @param ConflictPolicy What to do if another tween already drives this channel of the component
+     */
+    UFUNCTION(BlueprintCallable,
+        meta = (BlueprintInternalUseOnly = "true",
+            WorldContext = "worldContextObject",
+            AdvancedDisplay = "threadingType,conflictPolicy",
+            DisplayName = "Rotate Component",
+            Keywords = "rotate,rotation,relative,component,hinge,async,interpolate,animation,duration,velocity,speed"),
+        Category = "AdvBPTools|Movement")
+    static UAsyncTweenComponentTask* RotateComponent(
+        UObject* worldContextObject,
+        USceneComponent* component,
+        FRotator desiredRotation,
+        float time = 1.0f,
+        EMoveTimingMode timingMode = EMoveTimingMode::Duration,
+        EEasingFunction easingType = EEasingFunction::Linear,
+        bool bShortestPath = true,
+        EThreadingType threadingType = EThreadingType::GameThread,
+        ETweenConflictPolicy conflictPolicy = ETweenConflictPolicy::Replace);
+
+    /**
+     * Scales a component to specified relative scale
+     *
+     * @param Component Scene component to scale
+     * @param DesiredScale Target relative scale
+     * @param Duration Time in seconds
+     * @param EasingType Interpolation curve type
+     * @param ThreadingType Where the interpolation math runs; the component is always scaled on the game thread
+     * @param ConflictPolicy What to do if another tween already drives this channel of the component
+     */
+    UFUNCTION(BlueprintCallable,
+        meta = (BlueprintInternalUseOnly = "true",
+            WorldContext = "worldContextObject",
+            AdvancedDisplay = "threadingType,conflictPolicy",
+            DisplayName = "Scale Component",
+            Keywords = "scale,size,relative,component,async,interpolate,animation,duration"),
+        Category = "AdvBPTools|Movement")
+    static UAsyncTweenComponentTask* ScaleComponent(
+        UObject* worldContextObject,
+        USceneComponent* component,
+        FVector desiredScale,
+        float duration = 1.0f,
+        EEasingFunction easingType = EEasingFunction::Linear,
+        EThreadingType threadingType = EThreadingType::GameThread,
+        ETweenConflictPolicy conflictPolicy = ETweenConflictPolicy::Replace);
+
+    // UBlueprintAsyncActionBase interface
+    virtual void Activate() override;
+
+private:
+    // Task parameters
+    UPROPERTY()
+    USceneComponent* Component;
+
+    UPROPERTY()
+    FVector DesiredVector;
+
+    UPROPERTY()
+    FRotator DesiredRotation;
+
+    UPROPERTY()
+    float Time;
+
+    UPROPERTY()
+    EMoveTimingMode TimingMode;
+
+    UPROPERTY()
+    EEasingFunction EasingType;
+
+    UPROPERTY()
+    bool bSweep;
+
+    UPROPERTY()
+    bool bShortestPath;
+
+    UPROPERTY()
+    EThreadingType ThreadingType;
+
+    UPROPERTY()
+    ETweenConflictPolicy ConflictPolicy;
+
+    // Transform channel this run drives
+    ETweenChannel Channel;
+
+    // UAdvAsyncTweenTask interface
+    virtual void ResetTaskReferences() override;
+
+    // Create a task from the pool and store the parameters shared by all channels
+    static UAsyncTweenComponentTask* CreateTask(
+        UObject* worldContextObject,
+        USceneComponent* component,
+        ETweenChannel channel,
+        float time,
+        EMoveTimingMode timingMode,
+        EEasingFunction easingType,
+        EThreadingType threadingType,
+        ETweenConflictPolicy conflictPolicy);
+};
+
+/**
+ * Asynchronous task for tweening material parameters without dynamic material instances
+ * Custom primitive data of one component and parameters of one collection are each written once per frame
+ */
+UCLASS()
+class UAsyncTweenMaterialParameterTask : public UAdvAsyncTweenTask
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Tweens one float of a component's custom primitive data, read by Custom Primitive Data material nodes
+     *
+     * @param Component Primitive component whose data to change
+     * @param DataIndex Index of the float to tween
+     * @param DesiredValue Value to arrive at
+     * @param Duration Time in seconds
+     * @param EasingType Interpolation curve type
+     * @param ThreadingType Where the interpolation math runs; data is always written on the game thread
+     */
+    UFUNCTION(BlueprintCallable,
+        meta = (BlueprintInternalUseOnly = "true",
+            WorldContext = "worldContextObject",
+            AdvancedDisplay = "threadingType",
+            DisplayName = "Tween Custom Primitive Data Float",
+            Keywords = "material,parameter,custom,primitive,data,fade,pulse,async,interpolate,animation"),
+        Category = "AdvBPTools|Material")
+    static UAsyncTweenMaterialParameterTask* TweenPrimitiveDataScalar(
+        UObject* worldContextObject,
+        UPrimitiveComponent* component,
+        int32 dataIndex,
+        float desiredValue,
+        float duration = 1.0f,
+        EEasingFunction easingType = EEasingFunction::Linear,
+        EThreadingType threadingType = EThreadingType::GameThread);
+
+    /**
+     * Tweens four consecutive floats of a component's custom primitive data as a color
+     *
+     * @param Component Primitive component whose data to change
+     * @param DataIndex Index of the first of the four floats, which hold R, G, B and A
+     * @param DesiredValue Value to arrive at
+     * @param Duration Time in seconds
+     * @param EasingType Interpolation curve type
+     * @param ThreadingType Where the interpolation math runs; data is always written on the game thread
+     */
+    UFUNCTION(BlueprintCallable,
+        meta = (BlueprintInternalUseOnly = "true",
+            WorldContext = "worldContextObject",
+            AdvancedDisplay = "threadingType",
+            DisplayName = "Tween Custom Primitive Data Color",
+            Keywords = "material,parameter,custom,primitive,data,color,highlight,async,interpolate,animation"),
+        Category = "AdvBPTools|Material")
+    static UAsyncTweenMaterialParameterTask* TweenPrimitiveDataVector(
+        UObject* worldContextObject,
+        UPrimitiveComponent* component,
+        int32 dataIndex,
+        FLinearColor desiredValue,
+        float duration = 1.0f,
+        EEasingFunction easingType = EEasingFunction::Linear,
+        EThreadingType threadingType = EThreadingType::GameThread);
+
+    /**
+     * Tweens a scalar parameter of a material parameter collection
+     *
+     * @param Collection Collection owning the parameter
+     * @param ParameterName Name of the scalar parameter
+     * @param DesiredValue Value to arrive at
+     * @param Duration Time in seconds
+     * @param EasingType Interpolation curve type
+     * @param ThreadingType Where the interpolation math runs; parameters are always written on the game thread
+     */
+    UFUNCTION(BlueprintCallable,
+        meta = (BlueprintInternalUseOnly = "true",
+            WorldContext = "worldContextObject",
+            AdvancedDisplay = "threadingType",
+            DisplayName = "Tween Collection Scalar Parameter",
+            Keywords = "material,parameter,collection,mpc,scalar,fade,async,interpolate,animation"),
+        Category = "AdvBPTools|Material")
+    static UAsyncTweenMaterialParameterTask* TweenCollectionScalar(
+        UObject* worldContextObject,
+        UMaterialParameterCollection* collection,
+        FName parameterName,
+        float desiredValue,
+        float duration = 1.0f,
+        EEasingFunction easingType = EEasingFunction::Linear,
+        EThreadingType threadingType = EThreadingType::GameThread);
+
+    /**
+     * Tweens a vector parameter of a material parameter collection
+     *
+     * @param Collection Collection owning the parameter
+     * @param ParameterName Name of the vector parameter
+     * @param DesiredValue Value to arrive at
+     * @param Duration Time in seconds
+     * @param EasingType Interpolation curve type
+     * @param ThreadingType Where the interpolation math runs; parameters are always written on the game thread
+     */
+    UFUNCTION(BlueprintCallable,
+        meta = (BlueprintInternalUseOnly = "true",
+            WorldContext = "worldContextObject",
+            AdvancedDisplay = "threadingType",
+            DisplayName = "Tween Collection Vector Parameter",
+            Keywords = "material,parameter,collection,mpc,vector,color,async,interpolate,animation"),
+        Category = "AdvBPTools|Material")
+    static UAsyncTweenMaterialParameterTask* TweenCollectionVector(
+        UObject* worldContextObject,
+        UMaterialParameterCollection* collection,
+        FName parameterName,
+        FLinearColor desiredValue,
+        float duration = 1.0f,
+        EEasingFunction easingType = EEasingFunction::Linear,
+        EThreadingType threadingType = EThreadingType::GameThread);
+
+    // UBlueprintAsyncActionBase interface
+    virtual void Activate() override;
+
+private:
+    // Task parameters; either the component or the collection is set
+    UPROPERTY()
+    UPrimitiveComponent* Component;
+
+    UPROPERTY()
+    UMaterialParameterCollection* Collection;
+
+    UPROPERTY()
+    FName ParameterName;
+
+    UPROPERTY()
+    int32 DataIndex;
+
+    UPROPERTY()
+    FLinearColor DesiredValue;
+
+    UPROPERTY()
+    bool bVector;
+
+    UPROPERTY()
+    float Duration;
+
+    UPROPERTY()
+    EEasingFunction EasingType;
+
+    UPROPERTY()
+    EThreadingType ThreadingType;
+
+    // UAdvAsyncTweenTask interface
+    virtual void ResetTaskReferences() override;
+
+    // Create a task from the pool and store the parameters shared by all parameter kinds
+    static UAsyncTweenMaterialParameterTask* CreateTask(
+        UObject* worldContextObject,
+        const FLinearColor& desiredValue,
+        bool bVector,
+        float duration,
+        EEasingFunction easingType,
+        EThreadingType threadingType);
+};
+
+/**
+ * Asynchronous task for tweening float, vector, rotator and color properties of any object by name
+ * The property is looked up once when the tween starts; setters and OnRep functions are not called
+ */
+UCLASS()
+class UAsyncTweenPropertyTask : public UAdvAsyncTweenTask
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Tweens a float property of an object, single and double precision alike
+     *
+     * @param Target Object owning the property
+     * @param PropertyName Name of the property
+     * @param DesiredValue Value to arrive at
+     * @param Duration Time in seconds
+     * @param EasingType Interpolation curve type
+     * @param ThreadingType Where the interpolation math runs; the property is always written on the game thread
+     */
+    UFUNCTION(BlueprintCallable,
+        meta = (BlueprintInternalUseOnly = "true",
+            WorldContext = "worldContextObject",
+            AdvancedDisplay = "threadingType",
+            DisplayName = "Tween Float Property",
+            Keywords = "property,variable,float,fade,async,interpolate,animation"),
+        Category = "AdvBPTools|Property")
+    static UAsyncTweenPropertyTask* TweenFloatProperty(
+        UObject* worldContextObject,
+        UObject* target,
+        FName propertyName,
+        float desiredValue,
+        float duration = 1.0f,
+        EEasingFunction easingType = EEasingFunction::Linear,
+        EThreadingType threadingType = EThreadingType::GameThread);
+
+    /**
+     * Tweens a vector property of an object
+     *
+     * @param Target Object owning the property
+     * @param PropertyName Name of the property
+     * @param DesiredValue Value to arrive at
+     * @param Duration Time in seconds
+     * @param EasingType Interpolation curve type
+     * @param ThreadingType Where the interpolation math runs; the property is always written on the game thread
+     */
+    UFUNCTION(BlueprintCallable,
+        meta = (BlueprintInternalUseOnly = "true",
+            WorldContext = "worldContextObject",
+            AdvancedDisplay = "threadingType",
+            DisplayName = "Tween Vector Property",
+            Keywords = "property,variable,vector,async,interpolate,animation"),
+        Category = "AdvBPTools|Property")
+    static UAsyncTweenPropertyTask* TweenVectorProperty(
+        UObject* worldContextObject,
+        UObject* target,
+        FName propertyName,
+        FVector desiredValue,
+        float duration = 1.0f,
+        EEasingFunction easingType = EEasingFunction::Linear,
+        EThreadingType threadingType = EThreadingType::GameThread);
+
+    /**
+     * Tweens a rotator property of an object along the shortest path
+     *
+     * @param Target Object owning the property
+     * @param PropertyName Name of the property
+     * @param DesiredValue Value to arrive at
+     * @param Duration Time in seconds
+     * @param EasingType Interpolation curve type
+     * @param ThreadingType Where the interpolation math runs; the property is always written on the game thread
+     */
+    UFUNCTION(BlueprintCallable,
+        meta = (BlueprintInternalUseOnly = "true",
+            WorldContext = "worldContextObject",
+            AdvancedDisplay = "threadingType",
+            DisplayName = "Tween Rotator Property",
+            Keywords = "property,variable,rotator,rotation,async,interpolate,animation"),
+        Category = "AdvBPTools|Property")
+    static UAsyncTweenPropertyTask* TweenRotatorProperty(
+        UObject* worldContextObject,
+        UObject* target,
+        FName propertyName,
+        FRotator desiredValue,
+        float duration = 1.0f,
+        EEasingFunction easingType = EEasingFunction::Linear,
+        EThreadingType threadingType = EThreadingType::GameThread);
+
+    /**
+     * Tweens a linear color property of an object
+     *
+     * @param Target Object owning the property
+     * @param PropertyName Name of the property
+     * @param DesiredValue Value to arrive at
+     * @param Duration Time in seconds
+     * @param EasingType Interpolation curve type
+     * @param ThreadingType Where the interpolation math runs; the property is always written on the game thread
+     */
+    UFUNCTION(BlueprintCallable,
+        meta = (BlueprintInternalUseOnly = "true",
+            WorldContext = "worldContextObject",
+            AdvancedDisplay = "threadingType",
+            DisplayName = "Tween Color Property",
+            Keywords = "property,variable,color,colour,async,interpolate,animation"),
+        Category = "AdvBPTools|Property")
+    static UAsyncTweenPropertyTask* TweenColorProperty(
+        UObject* worldContextObject,
+        UObject* target,
+        FName propertyName,
+        FLinearColor desiredValue,
+        float duration = 1.0f,
+        EEasingFunction easingType = EEasingFunction::Linear,
+        EThreadingType threadingType = EThreadingType::GameThread);
+
+    // UBlueprintAsyncActionBase interface
+    virtual void Activate() override;
+
+private:
+    // Task parameters
+    UPROPERTY()
+    UObject* Target;
+
+    UPROPERTY()
+    FName PropertyName;
+
+    // Value packed the way the tween subsystem stores it
+    UPROPERTY()
+    FVector4 DesiredValue;
+
+    UPROPERTY()
+    float Duration;
+
+    UPROPERTY()
+    EEasingFunction EasingType;
+
+    UPROPERTY()
+    EThreadingType ThreadingType;
+
+    ETweenPropertyType PropertyType;
+
+    // UAdvAsyncTweenTask interface
+    virtual void ResetTaskReferences() override;
+
+    // Create a task from the pool and store the parameters shared by all property types
+    static UAsyncTweenPropertyTask* CreateTask(
+        UObject* worldContextObject,
+        UObject* target,
+        FName propertyName,
+        ETweenPropertyType propertyType,
+        const FVector4d& desiredValue,
+        float duration,
+        EEasingFunction easingType,
+        EThreadingType threadingType);
+};
+
+/**
+ * Asynchronous task for moving actors along a spline at constant speed
+ */
+UCLASS()
+class UAsyncMoveAlongSplineTask : public UAdvAsyncTweenTask
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Moves an actor along a spline, easing the distance travelled
+     *
+     * @param TargetActor Actor to move
+     * @param Spline Path to follow
+     * @param Time Time in seconds or units per second along the spline (depending on timingMode)
+     * @param TimingMode Whether to use duration or velocity for timing
+     * @param EasingType Interpolation curve applied to the distance along the spline
+     * @param bOrientToSpline Whether to also rotate the actor to the spline's direction
+     * @param bReverse Whether to travel from the end of the spline to its start
+     * @param ThreadingType Where the interpolation math runs; the actor is always moved on the game thread
+     * @param ConflictPolicy What to do if another tween already drives the location of the actor
+     */
+    UFUNCTION(BlueprintCallable,
+        meta = (BlueprintInternalUseOnly = "true",
+            WorldContext = "worldContextObject",
+            AdvancedDisplay = "threadingType,conflictPolicy",
+            DisplayName = "Move Actor Along Spline",
+            Keywords = "move,spline,path,async,interpolate,animation,duration,velocity,speed"),
+        Category = "AdvBPTools|Movement")
+    static UAsyncMoveAlongSplineTask* MoveActorAlongSpline(
+        UObject* worldContextObject,
+        AActor* targetActor,
+        USplineComponent* spline,
+        float time = 1.0f,
+        EMoveTimingMode timingMode = EMoveTimingMode::Duration,
+        EEasingFunction easingType = EEasingFunction::Linear,
+        bool bOrientToSpline = false,
+        bool bReverse = false,
+        EThreadingType threadingType = EThreadingType::GameThread,
+        ETweenConflictPolicy conflictPolicy = ETweenConflictPolicy::Replace);
+
+    // UBlueprintAsyncActionBase interface
+    virtual void Activate() override;
+
+private:
+    // Task parameters
+    UPROPERTY()
+    AActor* TargetActor;
+
+    UPROPERTY()
+    USplineComponent* Spline;
+
+    UPROPERTY()
+    float Time;
+
+    UPROPERTY()
+    EMoveTimingMode TimingMode;
+
+    UPROPERTY()
+    EEasingFunction EasingType;
+
+    UPROPERTY()
+    bool bOrientToSpline;
+
+    UPROPERTY()
+    bool bReverse;
+
+    UPROPERTY()
+    EThreadingType ThreadingType;
+
+    UPROPERTY()
+    ETweenConflictPolicy ConflictPolicy;
+
+    // UAdvAsyncTweenTask interface
+    virtual void ResetTaskReferences() override;
+};
+
+/**
+ * Asynchronous task for moving an actor onto another, possibly moving, actor
+ */
+UCLASS()
+class UAsyncMoveToActorTask : public UAdvAsyncTweenTask
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Moves an actor to another actor, following it if it moves while the tween plays
+     * The followed actor's location is sampled once per update and blended in without breaking the motion.
+     *
+     * @param TargetActor Actor to move
+     * @param FollowActor Actor to arrive at
+     * @param LocationOffset World-space offset from the followed actor's location
+     * @param Duration Time in seconds
+     * @param EasingType Interpolation curve type
+     * @param bSweep Whether to sweep for collisions during movement
+     * @param ThreadingType Where the interpolation math runs; the actor is always moved on the game thread
+     * @param ConflictPolicy What to do if another tween already drives the location of the actor
+     */
+    UFUNCTION(BlueprintCallable,
+        meta = (BlueprintInternalUseOnly = "true",
+            WorldContext = "worldContextObject",
+            AdvancedDisplay = "threadingType,conflictPolicy",
+            DisplayName = "Move Actor To Actor",
+            Keywords = "move,follow,chase,home,target,actor,async,interpolate,animation"),
+        Category = "AdvBPTools|Movement")
+    static UAsyncMoveToActorTask* MoveActorToActor(
+        UObject* worldContextObject,
+        AActor* targetActor,
+        AActor* followActor,
+        FVector locationOffset,
+        float duration = 1.0f,
+        EEasingFunction easingType = EEasingFunction::Linear,
+        bool bSweep = false,
+        EThreadingType threadingType = EThreadingType::GameThread,
+        ETweenConflictPolicy conflictPolicy = ETweenConflictPolicy::Replace);
+
+    // UBlueprintAsyncActionBase interface
+    virtual void Activate() override;
+
+private:
+    // Task parameters
+    UPROPERTY()
+    AActor* TargetActor;
+
+    UPROPERTY()
+    AActor* FollowActor;
+
+    UPROPERTY()
+    FVector LocationOffset;
+
+    UPROPERTY()
+    float Duration;
+
+    UPROPERTY()
+    EEasingFunction EasingType;
+
+    UPROPERTY()
+    bool bSweep;
+
+    UPROPERTY()
+    EThreadingType ThreadingType;
+
+    UPROPERTY()
+    ETweenConflictPolicy ConflictPolicy;
+
+    // UAdvAsyncTweenTask interface
+    virtual void ResetTaskReferences() override;
+};
+
+/**
+ * Asynchronous task for playing a keyframe track on an actor
+ */
+UCLASS()
+class UAsyncPlayKeyframesTask : public UAdvAsyncTweenTask
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Plays a track of transform keys on an actor, each segment with its own easing
+     *
+     * @param TargetActor Actor to animate
+     * @param Keys World-space keys of the track; a first key after zero starts from the actor's current transform
+     * @param bDriveLocation Whether the track moves the actor
+     * @param bDriveRotation Whether the track rotates the actor
+     * @param bDriveScale Whether the track scales the actor
+     * @param bSweep Whether to sweep for collisions during movement
+     * @param ThreadingType Where the interpolation math runs; the actor is always moved on the game thread
+     * @param ConflictPolicy What to do if another tween already drives the first driven channel of the actor
+     */
+    UFUNCTION(BlueprintCallable,
+        meta = (BlueprintInternalUseOnly = "true",
+            WorldContext = "worldContextObject",
+            AdvancedDisplay = "bSweep,threadingType,conflictPolicy",
+            DisplayName = "Play Keyframe Track",
+            Keywords = "keyframe,track,keys,timeline,async,interpolate,animation"),
+        Category = "AdvBPTools|Movement")
+    static UAsyncPlayKeyframesTask* PlayKeyframeTrack(
+        UObject* worldContextObject,
+        AActor* targetActor,
+        const TArray<FAdvTransformKey>& keys,
+        bool bDriveLocation = true,
+        bool bDriveRotation = false,
+        bool bDriveScale = false,
+        bool bSweep = false,
+        EThreadingType threadingType = EThreadingType::GameThread,
+        ETweenConflictPolicy conflictPolicy = ETweenConflictPolicy::Replace);
+
+    // UBlueprintAsyncActionBase interface
+    virtual void Activate() override;
+
+private:
+    // Task parameters
+    UPROPERTY()
+    AActor* TargetActor;
+
+    UPROPERTY()
+    TArray<FAdvTransformKey> Keys;
+
+    UPROPERTY()
+    bool bDriveLocation;
+
+    UPROPERTY()
+    bool bDriveRotation;
+
+    UPROPERTY()
+    bool bDriveScale;
+
+    UPROPERTY()
+    bool bSweep;
+
+    UPROPERTY()
+    EThreadingType ThreadingType;
+
+    UPROPERTY()
+    ETweenConflictPolicy ConflictPolicy;
+
+    // UAdvAsyncTweenTask interface
+    virtual void ResetTaskReferences() override;
+};
+
+/**
+ * Asynchronous task for playing a whole sequence of tween steps as one node
+ */
+UCLASS()
+class UAsyncPlayTweenSequenceTask : public UAdvAsyncTweenTask
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Plays move, rotate, scale and delay steps one after another, with parallel groups, without a frame between steps
+     *
+     * @param TargetActor Actor to animate
+     * @param Steps Steps in playback order; steps marked With Previous run together with the step before them
+     * @param bSweep Whether Move steps sweep for collisions
+     * @param ThreadingType Where the interpolation math runs; the actor is always moved on the game thread
+     */
+    UFUNCTION(BlueprintCallable,
+        meta = (BlueprintInternalUseOnly = "true",
+            WorldContext = "worldContextObject",
+            AdvancedDisplay = "bSweep,threadingType",
+            DisplayName = "Play Tween Sequence",
+            Keywords = "sequence,chain,timeline,steps,async,interpolate,animation"),
+        Category = "AdvBPTools|Movement")
+    static UAsyncPlayTweenSequenceTask* PlayTweenSequence(
+        UObject* worldContextObject,
+        AActor* targetActor,
+        const TArray<FAdvTweenStep>& steps,
+        bool bSweep = false,
+        EThreadingType threadingType = EThreadingType::GameThread);
+
+    // UBlueprintAsyncActionBase interface
+    virtual void Activate() override;
+
+private:
+    // Task parameters
+    UPROPERTY()
+    AActor* TargetActor;
+
+    UPROPERTY()
+    TArray<FAdvTweenStep> Steps;
+
+    UPROPERTY()
+    bool bSweep;
+
+    UPROPERTY()
+    EThreadingType ThreadingType;
+
+    // Sequence driving this task in the world's tween subsystem
+    FTweenSequenceHandle SequenceHandle;
+
+    // UAdvAsyncTweenTask interface
+    virtual void ResetTaskReferences() override;
+};